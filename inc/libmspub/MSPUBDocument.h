@@ -28,13 +28,38 @@
 
 namespace libmspub
 {
+class MSPUBDocumentImpl;
+
 class MSPUBDocument
 {
 public:
+  enum Version
+  {
+    VERSION_UNKNOWN = 0,
+    VERSION_97,
+    VERSION_2000,
+    VERSION_2002 // and later
+  };
 
   static PUBAPI bool isSupported(librevenge::RVNGInputStream *input);
 
   static PUBAPI bool parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *painter);
+  static PUBAPI bool parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *painter, unsigned firstPage, unsigned lastPage);
+
+  static PUBAPI MSPUBDocument *open(librevenge::RVNGInputStream *input);
+
+  PUBAPI ~MSPUBDocument();
+
+  PUBAPI Version getVersion() const;
+
+  PUBAPI bool parse(librevenge::RVNGDrawingInterface *painter);
+
+private:
+  explicit MSPUBDocument(MSPUBDocumentImpl *impl);
+  MSPUBDocument(const MSPUBDocument &);
+  MSPUBDocument &operator=(const MSPUBDocument &);
+
+  MSPUBDocumentImpl *m_impl;
 };
 
 } // namespace libmspub
@@ -0,0 +1,694 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MappedFileStream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace libmspub
+{
+
+class MappedFile
+{
+public:
+  explicit MappedFile(const char *filename);
+  ~MappedFile();
+
+  const unsigned char *data() const
+  {
+    return m_data;
+  }
+  unsigned long size() const
+  {
+    return m_size;
+  }
+
+private:
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+  const unsigned char *m_data;
+  unsigned long m_size;
+#ifdef _WIN32
+  HANDLE m_mapping;
+#endif
+};
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const char *const filename)
+  : m_data(nullptr), m_size(0), m_mapping(nullptr)
+{
+  HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return;
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (unsigned long long)size.QuadPart <= (unsigned long)-1)
+  {
+    m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping)
+    {
+      m_data = static_cast<const unsigned char *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+      if (m_data)
+        m_size = (unsigned long)size.QuadPart;
+    }
+  }
+  CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping)
+    CloseHandle(m_mapping);
+}
+
+#else
+
+MappedFile::MappedFile(const char *const filename)
+  : m_data(nullptr), m_size(0)
+{
+  const int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+    return;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && (unsigned long long)st.st_size <= (unsigned long)-1)
+  {
+    void *const p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      m_data = static_cast<const unsigned char *>(p);
+      m_size = (unsigned long)st.st_size;
+    }
+  }
+  close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+  if (m_data)
+    munmap(const_cast<unsigned char *>(m_data), m_size);
+}
+
+#endif
+
+// A run of bytes of a substream that is contiguous in the file
+struct Extent
+{
+  Extent(unsigned long offset_, unsigned long length_) : offset(offset_), length(length_) { }
+  unsigned long offset;
+  unsigned long length;
+};
+
+struct OLEStreamEntry
+{
+  OLEStreamEntry() : name(), extents(), size(0) { }
+  std::string name;
+  std::vector<Extent> extents;
+  unsigned long size;
+};
+
+struct OLEDirectory
+{
+  OLEDirectory() : streams() { }
+  std::vector<OLEStreamEntry> streams;
+
+  const OLEStreamEntry *find(const char *name) const;
+};
+
+const OLEStreamEntry *OLEDirectory::find(const char *const name) const
+{
+  if (!name)
+    return nullptr;
+  for (const auto &stream : streams)
+  {
+    if (stream.name == name)
+      return &stream;
+  }
+  return nullptr;
+}
+
+namespace
+{
+
+const uint32_t OLE_MAX_SECT = 0xFFFFFFFA;
+const uint32_t OLE_END_OF_CHAIN = 0xFFFFFFFE;
+const uint32_t OLE_NO_STREAM = 0xFFFFFFFF;
+
+const unsigned OLE_HEADER_DIFAT_ENTRIES = 109;
+const unsigned OLE_DIRECTORY_ENTRY_SIZE = 128;
+
+const unsigned char OLE_TYPE_STORAGE = 1;
+const unsigned char OLE_TYPE_STREAM = 2;
+const unsigned char OLE_TYPE_ROOT = 5;
+
+const unsigned char OLE_SIGNATURE[] = { 0xd0, 0xcf, 0x11, 0xe0, 0xa1, 0xb1, 0x1a, 0xe1 };
+
+uint16_t getU16(const unsigned char *const p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t getU32(const unsigned char *const p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void appendUTF8(std::string &out, unsigned ucs4)
+{
+  if (ucs4 < 0x80)
+  {
+    out.push_back(char(ucs4));
+  }
+  else if (ucs4 < 0x800)
+  {
+    out.push_back(char(0xc0 | (ucs4 >> 6)));
+    out.push_back(char(0x80 | (ucs4 & 0x3f)));
+  }
+  else
+  {
+    out.push_back(char(0xe0 | (ucs4 >> 12)));
+    out.push_back(char(0x80 | ((ucs4 >> 6) & 0x3f)));
+    out.push_back(char(0x80 | (ucs4 & 0x3f)));
+  }
+}
+
+void appendExtent(std::vector<Extent> &extents, unsigned long offset, unsigned long length)
+{
+  if (!extents.empty() && extents.back().offset + extents.back().length == offset)
+    extents.back().length += length;
+  else
+    extents.push_back(Extent(offset, length));
+}
+
+struct DirectoryEntry
+{
+  DirectoryEntry() : name(), type(0), left(OLE_NO_STREAM), right(OLE_NO_STREAM), child(OLE_NO_STREAM), start(0), size(0) { }
+  std::string name;
+  unsigned char type;
+  uint32_t left;
+  uint32_t right;
+  uint32_t child;
+  uint32_t start;
+  unsigned long size;
+};
+
+/* Reads the directory of an OLE2 compound file. Substreams are resolved
+ * to extents of the file, so they can be read from the mapping without
+ * copying them.
+ */
+class OLEReader
+{
+public:
+  OLEReader(const unsigned char *data, unsigned long size)
+    : m_data(data), m_size(size), m_sectorShift(0), m_miniSectorShift(0), m_miniStreamCutoff(0),
+      m_fat(), m_miniFat(), m_miniStream()
+  {
+  }
+
+  std::shared_ptr<const OLEDirectory> read();
+
+private:
+  unsigned long sectorSize() const
+  {
+    return 1UL << m_sectorShift;
+  }
+  const unsigned char *sector(uint32_t index) const;
+  bool followChain(uint32_t start, const std::vector<uint32_t> &table, std::vector<uint32_t> &chain) const;
+  bool readTable(const std::vector<uint32_t> &sectors, std::vector<uint32_t> &table) const;
+  bool readFat();
+  void readEntries(const std::vector<uint32_t> &dirSectors, std::vector<DirectoryEntry> &entries) const;
+  void resolveStream(const DirectoryEntry &entry, OLEStreamEntry &stream) const;
+
+  const unsigned char *const m_data;
+  const unsigned long m_size;
+  unsigned m_sectorShift;
+  unsigned m_miniSectorShift;
+  uint32_t m_miniStreamCutoff;
+  std::vector<uint32_t> m_fat;
+  std::vector<uint32_t> m_miniFat;
+  std::vector<Extent> m_miniStream;
+};
+
+const unsigned char *OLEReader::sector(const uint32_t index) const
+{
+  if (index > OLE_MAX_SECT)
+    return nullptr;
+  const unsigned long long offset = ((unsigned long long)index + 1) << m_sectorShift;
+  if (offset + sectorSize() > m_size)
+    return nullptr;
+  return m_data + offset;
+}
+
+// On a broken chain, returns false with the sectors before the break in chain.
+bool OLEReader::followChain(const uint32_t start, const std::vector<uint32_t> &table, std::vector<uint32_t> &chain) const
+{
+  chain.clear();
+  // a chain can only pass a sector once; anything else is a loop
+  std::vector<bool> visited(table.size(), false);
+  uint32_t current = start;
+  while (current != OLE_END_OF_CHAIN)
+  {
+    if (current >= table.size() || visited[current])
+      return false;
+    visited[current] = true;
+    chain.push_back(current);
+    current = table[current];
+  }
+  return true;
+}
+
+bool OLEReader::readTable(const std::vector<uint32_t> &sectors, std::vector<uint32_t> &table) const
+{
+  const unsigned long entriesPerSector = sectorSize() / 4;
+  table.reserve(table.size() + sectors.size() * entriesPerSector);
+  for (uint32_t index : sectors)
+  {
+    const unsigned char *const p = sector(index);
+    if (!p)
+      return false;
+    for (unsigned long i = 0; i < entriesPerSector; ++i)
+      table.push_back(getU32(p + 4 * i));
+  }
+  return true;
+}
+
+bool OLEReader::readFat()
+{
+  const uint32_t numFatSectors = getU32(m_data + 0x2c);
+  const unsigned long entriesPerSector = sectorSize() / 4;
+  // every FAT sector has to fit into the file
+  if (numFatSectors > m_size / sectorSize())
+    return false;
+
+  std::vector<uint32_t> fatSectors;
+  fatSectors.reserve(numFatSectors);
+  for (unsigned i = 0; i < OLE_HEADER_DIFAT_ENTRIES && fatSectors.size() < numFatSectors; ++i)
+    fatSectors.push_back(getU32(m_data + 0x4c + 4 * i));
+
+  uint32_t difatSector = getU32(m_data + 0x44);
+  uint32_t numDifatSectors = getU32(m_data + 0x48);
+  while (fatSectors.size() < numFatSectors && numDifatSectors-- > 0)
+  {
+    const unsigned char *const p = sector(difatSector);
+    if (!p)
+      return false;
+    for (unsigned long i = 0; i + 1 < entriesPerSector && fatSectors.size() < numFatSectors; ++i)
+      fatSectors.push_back(getU32(p + 4 * i));
+    difatSector = getU32(p + 4 * (entriesPerSector - 1));
+  }
+  if (fatSectors.size() < numFatSectors)
+    return false;
+
+  return readTable(fatSectors, m_fat);
+}
+
+void OLEReader::readEntries(const std::vector<uint32_t> &dirSectors, std::vector<DirectoryEntry> &entries) const
+{
+  const unsigned long entriesPerSector = sectorSize() / OLE_DIRECTORY_ENTRY_SIZE;
+  for (uint32_t index : dirSectors)
+  {
+    const unsigned char *const p = sector(index);
+    if (!p)
+      return;
+    for (unsigned long i = 0; i < entriesPerSector; ++i)
+    {
+      const unsigned char *const e = p + i * OLE_DIRECTORY_ENTRY_SIZE;
+      DirectoryEntry entry;
+      const unsigned nameLength = std::min<unsigned>(getU16(e + 0x40), 64);
+      for (unsigned j = 0; j + 1 < nameLength; j += 2)
+      {
+        const unsigned c = getU16(e + j);
+        if (c == 0)
+          break;
+        appendUTF8(entry.name, c);
+      }
+      entry.type = e[0x42];
+      entry.left = getU32(e + 0x44);
+      entry.right = getU32(e + 0x48);
+      entry.child = getU32(e + 0x4c);
+      entry.start = getU32(e + 0x74);
+      entry.size = getU32(e + 0x78);
+      // the high DWORD of the size is only used by version 4 files for streams over 4 GB
+      entries.push_back(entry);
+    }
+  }
+}
+
+void OLEReader::resolveStream(const DirectoryEntry &entry, OLEStreamEntry &stream) const
+{
+  // A broken chain or a sector out of the file cuts the stream short: it
+  // keeps the sectors before the break, and its size is what they hold.
+  std::vector<uint32_t> chain;
+  unsigned long left = entry.size;
+  if (entry.size < m_miniStreamCutoff)
+  {
+    followChain(entry.start, m_miniFat, chain);
+    const unsigned long miniSectorSize = 1UL << m_miniSectorShift;
+    for (uint32_t index : chain)
+    {
+      if (left == 0)
+        break;
+      // locate the mini sector in the mini stream; a mini sector never
+      // crosses a sector boundary, so it maps to one extent
+      unsigned long pos = (unsigned long)index << m_miniSectorShift;
+      auto it = m_miniStream.begin();
+      for (; it != m_miniStream.end() && pos >= it->length; ++it)
+        pos -= it->length;
+      if (it == m_miniStream.end() || pos + miniSectorSize > it->length)
+        break;
+      const unsigned long length = std::min(left, miniSectorSize);
+      appendExtent(stream.extents, it->offset + pos, length);
+      left -= length;
+    }
+  }
+  else
+  {
+    followChain(entry.start, m_fat, chain);
+    for (uint32_t index : chain)
+    {
+      if (left == 0)
+        break;
+      const unsigned long long offset = ((unsigned long long)index + 1) << m_sectorShift;
+      const unsigned long length = std::min(left, sectorSize());
+      // the last sector of a file may be cut short after the end of the stream
+      if (index > OLE_MAX_SECT || offset + length > m_size)
+        break;
+      appendExtent(stream.extents, (unsigned long)offset, length);
+      left -= length;
+    }
+  }
+  stream.size = entry.size - left;
+}
+
+std::shared_ptr<const OLEDirectory> OLEReader::read()
+{
+  if (m_size < 512 || memcmp(m_data, OLE_SIGNATURE, sizeof(OLE_SIGNATURE)) != 0)
+    return std::shared_ptr<const OLEDirectory>();
+
+  m_sectorShift = getU16(m_data + 0x1e);
+  m_miniSectorShift = getU16(m_data + 0x20);
+  m_miniStreamCutoff = getU32(m_data + 0x38);
+  if (m_sectorShift < 7 || m_sectorShift > 16 || m_miniSectorShift > m_sectorShift)
+    return std::shared_ptr<const OLEDirectory>();
+
+  if (!readFat())
+    return std::shared_ptr<const OLEDirectory>();
+
+  std::vector<uint32_t> chain;
+  if (!followChain(getU32(m_data + 0x30), m_fat, chain))
+    return std::shared_ptr<const OLEDirectory>();
+  std::vector<DirectoryEntry> entries;
+  readEntries(chain, entries);
+  if (entries.empty() || entries[0].type != OLE_TYPE_ROOT)
+    return std::shared_ptr<const OLEDirectory>();
+
+  // the mini stream is stored as the content of the root entry
+  if (followChain(getU32(m_data + 0x3c), m_fat, chain))
+    readTable(chain, m_miniFat);
+  if (followChain(entries[0].start, m_fat, chain))
+  {
+    for (uint32_t index : chain)
+    {
+      if (!sector(index))
+        break;
+      appendExtent(m_miniStream, ((unsigned long)index + 1) << m_sectorShift, sectorSize());
+    }
+  }
+
+  std::shared_ptr<OLEDirectory> directory(new OLEDirectory());
+  std::vector<bool> visited(entries.size(), false);
+  std::vector<std::pair<uint32_t, std::string> > pending;
+  pending.push_back(std::make_pair(entries[0].child, std::string()));
+  while (!pending.empty())
+  {
+    const uint32_t index = pending.back().first;
+    const std::string prefix = pending.back().second;
+    pending.pop_back();
+    if (index >= entries.size() || visited[index])
+      continue;
+    visited[index] = true;
+
+    const DirectoryEntry &entry = entries[index];
+    pending.push_back(std::make_pair(entry.right, prefix));
+    pending.push_back(std::make_pair(entry.left, prefix));
+    if (entry.type == OLE_TYPE_STORAGE)
+    {
+      pending.push_back(std::make_pair(entry.child, prefix + entry.name + "/"));
+    }
+    else if (entry.type == OLE_TYPE_STREAM)
+    {
+      OLEStreamEntry stream;
+      stream.name = prefix + entry.name;
+      resolveStream(entry, stream);
+      directory->streams.push_back(stream);
+    }
+  }
+  return directory;
+}
+
+class MappedSubStream : public librevenge::RVNGInputStream
+{
+public:
+  MappedSubStream(const std::shared_ptr<const MappedFile> &file, const OLEStreamEntry &entry)
+    : m_file(file), m_extents(entry.extents), m_starts(), m_size(entry.size), m_pos(0), m_buffer()
+  {
+    m_starts.reserve(m_extents.size());
+    unsigned long start = 0;
+    for (const auto &extent : m_extents)
+    {
+      m_starts.push_back(start);
+      start += extent.length;
+    }
+  }
+
+  bool isStructured() override
+  {
+    return false;
+  }
+  unsigned subStreamCount() override
+  {
+    return 0;
+  }
+  const char *subStreamName(unsigned) override
+  {
+    return nullptr;
+  }
+  bool existsSubStream(const char *) override
+  {
+    return false;
+  }
+  librevenge::RVNGInputStream *getSubStreamByName(const char *) override
+  {
+    return nullptr;
+  }
+  librevenge::RVNGInputStream *getSubStreamById(unsigned) override
+  {
+    return nullptr;
+  }
+
+  const unsigned char *read(unsigned long numBytes, unsigned long &numBytesRead) override;
+  int seek(long offset, librevenge::RVNG_SEEK_TYPE seekType) override;
+  long tell() override
+  {
+    return long(m_pos);
+  }
+  bool isEnd() override
+  {
+    return m_pos >= m_size;
+  }
+
+private:
+  const std::shared_ptr<const MappedFile> m_file;
+  const std::vector<Extent> m_extents;
+  std::vector<unsigned long> m_starts;
+  const unsigned long m_size;
+  unsigned long m_pos;
+  // holds the result of reads that span non-adjacent sectors
+  std::vector<unsigned char> m_buffer;
+};
+
+const unsigned char *MappedSubStream::read(const unsigned long numBytes, unsigned long &numBytesRead)
+{
+  numBytesRead = 0;
+  if (numBytes == 0 || m_pos >= m_size)
+    return nullptr;
+  const unsigned long length = std::min(numBytes, m_size - m_pos);
+
+  size_t i = size_t(std::upper_bound(m_starts.begin(), m_starts.end(), m_pos) - m_starts.begin()) - 1;
+  unsigned long inExtent = m_pos - m_starts[i];
+  if (inExtent + length <= m_extents[i].length)
+  {
+    numBytesRead = length;
+    m_pos += length;
+    return m_file->data() + m_extents[i].offset + inExtent;
+  }
+
+  m_buffer.resize(length);
+  unsigned long copied = 0;
+  while (copied < length && i < m_extents.size())
+  {
+    const unsigned long chunk = std::min(length - copied, m_extents[i].length - inExtent);
+    memcpy(m_buffer.data() + copied, m_file->data() + m_extents[i].offset + inExtent, chunk);
+    copied += chunk;
+    inExtent = 0;
+    ++i;
+  }
+  numBytesRead = copied;
+  m_pos += copied;
+  return m_buffer.data();
+}
+
+int MappedSubStream::seek(const long offset, const librevenge::RVNG_SEEK_TYPE seekType)
+{
+  long pos = offset;
+  if (seekType == librevenge::RVNG_SEEK_CUR)
+    pos += long(m_pos);
+  else if (seekType == librevenge::RVNG_SEEK_END)
+    pos += long(m_size);
+  if (pos < 0)
+  {
+    m_pos = 0;
+    return -1;
+  }
+  if ((unsigned long)pos > m_size)
+  {
+    m_pos = m_size;
+    return -1;
+  }
+  m_pos = (unsigned long)pos;
+  return 0;
+}
+
+}
+
+MappedFileStream::MappedFileStream(const char *const filename)
+  : m_file(new MappedFile(filename)), m_pos(0), m_directoryRead(false), m_directory()
+{
+}
+
+MappedFileStream::~MappedFileStream()
+{
+}
+
+bool MappedFileStream::isValid() const
+{
+  return bool(m_file->data());
+}
+
+const OLEDirectory *MappedFileStream::getDirectory()
+{
+  if (!m_directoryRead)
+  {
+    m_directoryRead = true;
+    if (isValid())
+      m_directory = OLEReader(m_file->data(), m_file->size()).read();
+  }
+  return m_directory.get();
+}
+
+bool MappedFileStream::isStructured()
+{
+  return bool(getDirectory());
+}
+
+unsigned MappedFileStream::subStreamCount()
+{
+  const OLEDirectory *const directory = getDirectory();
+  return directory ? unsigned(directory->streams.size()) : 0;
+}
+
+const char *MappedFileStream::subStreamName(const unsigned id)
+{
+  const OLEDirectory *const directory = getDirectory();
+  if (!directory || id >= directory->streams.size())
+    return nullptr;
+  return directory->streams[id].name.c_str();
+}
+
+bool MappedFileStream::existsSubStream(const char *const name)
+{
+  const OLEDirectory *const directory = getDirectory();
+  return directory && directory->find(name);
+}
+
+librevenge::RVNGInputStream *MappedFileStream::getSubStreamByName(const char *const name)
+{
+  const OLEDirectory *const directory = getDirectory();
+  const OLEStreamEntry *const entry = directory ? directory->find(name) : nullptr;
+  if (!entry)
+    return nullptr;
+  return new MappedSubStream(m_file, *entry);
+}
+
+librevenge::RVNGInputStream *MappedFileStream::getSubStreamById(const unsigned id)
+{
+  const OLEDirectory *const directory = getDirectory();
+  if (!directory || id >= directory->streams.size())
+    return nullptr;
+  return new MappedSubStream(m_file, directory->streams[id]);
+}
+
+const unsigned char *MappedFileStream::read(const unsigned long numBytes, unsigned long &numBytesRead)
+{
+  numBytesRead = 0;
+  if (numBytes == 0 || m_pos >= m_file->size())
+    return nullptr;
+  numBytesRead = std::min(numBytes, m_file->size() - m_pos);
+  const unsigned char *const p = m_file->data() + m_pos;
+  m_pos += numBytesRead;
+  return p;
+}
+
+int MappedFileStream::seek(const long offset, const librevenge::RVNG_SEEK_TYPE seekType)
+{
+  long pos = offset;
+  if (seekType == librevenge::RVNG_SEEK_CUR)
+    pos += long(m_pos);
+  else if (seekType == librevenge::RVNG_SEEK_END)
+    pos += long(m_file->size());
+  if (pos < 0)
+  {
+    m_pos = 0;
+    return -1;
+  }
+  if ((unsigned long)pos > m_file->size())
+  {
+    m_pos = m_file->size();
+    return -1;
+  }
+  m_pos = (unsigned long)pos;
+  return 0;
+}
+
+long MappedFileStream::tell()
+{
+  return long(m_pos);
+}
+
+bool MappedFileStream::isEnd()
+{
+  return m_pos >= m_file->size();
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,65 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MAPPEDFILESTREAM_H
+#define INCLUDED_MAPPEDFILESTREAM_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <librevenge/librevenge.h>
+
+namespace libmspub
+{
+
+class MappedFile;
+struct OLEDirectory;
+
+/* Input stream over a memory-mapped file. Unlike RVNGFileStream, the file
+ * is not copied into the heap: reads return pointers into the mapping, and
+ * substreams of an OLE2 compound file are read from the mapped sectors.
+ */
+class MappedFileStream : public librevenge::RVNGInputStream
+{
+public:
+  explicit MappedFileStream(const char *filename);
+  ~MappedFileStream() override;
+
+  // false if the file could not be opened or mapped
+  bool isValid() const;
+
+  bool isStructured() override;
+  unsigned subStreamCount() override;
+  const char *subStreamName(unsigned id) override;
+  bool existsSubStream(const char *name) override;
+  librevenge::RVNGInputStream *getSubStreamByName(const char *name) override;
+  librevenge::RVNGInputStream *getSubStreamById(unsigned id) override;
+
+  const unsigned char *read(unsigned long numBytes, unsigned long &numBytesRead) override;
+  int seek(long offset, librevenge::RVNG_SEEK_TYPE seekType) override;
+  long tell() override;
+  bool isEnd() override;
+
+private:
+  MappedFileStream(const MappedFileStream &);
+  MappedFileStream &operator=(const MappedFileStream &);
+
+  const OLEDirectory *getDirectory();
+
+  std::shared_ptr<const MappedFile> m_file;
+  unsigned long m_pos;
+  bool m_directoryRead;
+  std::shared_ptr<const OLEDirectory> m_directory;
+};
+
+}
+
+#endif // INCLUDED_MAPPEDFILESTREAM_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
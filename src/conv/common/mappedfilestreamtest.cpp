@@ -0,0 +1,500 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks that MappedFileStream returns the same substreams as
+ * RVNGFileStream. Without arguments, it writes a small OLE2 compound file
+ * with a fragmented stream and streams in the mini stream, and checks
+ * both readers against its known content, and then one with broken
+ * chains. Any files given on the command line are compared between the
+ * two readers.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <librevenge-stream/librevenge-stream.h>
+#include <librevenge/librevenge.h>
+
+#include "MappedFileStream.h"
+
+namespace
+{
+
+const char TEST_FILE_NAME[] = "mappedfilestreamtest.ole";
+
+const uint32_t FREE_SECT = 0xFFFFFFFF;
+const uint32_t END_OF_CHAIN = 0xFFFFFFFE;
+const uint32_t FAT_SECT = 0xFFFFFFFD;
+
+const unsigned SECTOR_SIZE = 512;
+const unsigned MINI_SECTOR_SIZE = 64;
+const unsigned MINI_STREAM_CUTOFF = 4096;
+
+struct TestEntry
+{
+  TestEntry(const std::string &name_, unsigned char type_, unsigned parent_)
+    : name(name_), type(type_), parent(parent_), content(), start(END_OF_CHAIN)
+  {
+  }
+  std::string name;
+  unsigned char type;
+  unsigned parent;
+  std::vector<unsigned char> content;
+  uint32_t start;
+};
+
+void putU16(std::vector<unsigned char> &out, unsigned long offset, unsigned value)
+{
+  out[offset] = (unsigned char)value;
+  out[offset + 1] = (unsigned char)(value >> 8);
+}
+
+void putU32(std::vector<unsigned char> &out, unsigned long offset, uint32_t value)
+{
+  for (unsigned i = 0; i < 4; ++i)
+    out[offset + i] = (unsigned char)(value >> (8 * i));
+}
+
+std::vector<unsigned char> makeContent(unsigned long size, unsigned seed)
+{
+  std::vector<unsigned char> content(size);
+  uint32_t state = seed;
+  for (auto &c : content)
+  {
+    state = state * 1103515245 + 12345;
+    c = (unsigned char)(state >> 16);
+  }
+  return content;
+}
+
+// the order of siblings in the directory tree: shorter names first
+bool compareNames(const TestEntry *left, const TestEntry *right)
+{
+  if (left->name.size() != right->name.size())
+    return left->name.size() < right->name.size();
+  std::string l(left->name);
+  std::string r(right->name);
+  std::transform(l.begin(), l.end(), l.begin(), ::toupper);
+  std::transform(r.begin(), r.end(), r.begin(), ::toupper);
+  return l < r;
+}
+
+/* Lays out the entries in a version 3 compound file. The sectors of the
+ * first two big streams are interleaved, so neither is contiguous in the
+ * file.
+ */
+std::vector<unsigned char> writeCompoundFile(std::vector<TestEntry> &entries)
+{
+  std::vector<uint32_t> fat;
+  std::vector<uint32_t> miniFat;
+  std::vector<unsigned char> miniStream;
+
+  // sector 0 holds the FAT
+  fat.push_back(FAT_SECT);
+
+  const unsigned entriesPerSector = SECTOR_SIZE / 128;
+  const unsigned numDirSectors = unsigned((entries.size() + entriesPerSector - 1) / entriesPerSector);
+  const uint32_t dirStart = uint32_t(fat.size());
+  for (unsigned i = 0; i < numDirSectors; ++i)
+    fat.push_back(i + 1 < numDirSectors ? uint32_t(fat.size() + 1) : END_OF_CHAIN);
+
+  for (auto &entry : entries)
+  {
+    if (entry.type != 2 || entry.content.size() >= MINI_STREAM_CUTOFF)
+      continue;
+    const unsigned long numMiniSectors = (entry.content.size() + MINI_SECTOR_SIZE - 1) / MINI_SECTOR_SIZE;
+    entry.start = numMiniSectors ? uint32_t(miniFat.size()) : END_OF_CHAIN;
+    for (unsigned long i = 0; i < numMiniSectors; ++i)
+      miniFat.push_back(i + 1 < numMiniSectors ? uint32_t(miniFat.size() + 1) : END_OF_CHAIN);
+    miniStream.insert(miniStream.end(), entry.content.begin(), entry.content.end());
+    miniStream.resize((miniStream.size() + MINI_SECTOR_SIZE - 1) / MINI_SECTOR_SIZE * MINI_SECTOR_SIZE);
+  }
+
+  std::vector<std::vector<unsigned char> > sectors(fat.size());
+  auto allocate = [&](const std::vector<unsigned char> &data, unsigned long offset) -> uint32_t
+  {
+    const uint32_t index = uint32_t(fat.size());
+    fat.push_back(END_OF_CHAIN);
+    std::vector<unsigned char> sector(SECTOR_SIZE, 0);
+    std::copy(data.begin() + long(offset), data.begin() + long(std::min<unsigned long>(offset + SECTOR_SIZE, data.size())), sector.begin());
+    sectors.push_back(sector);
+    return index;
+  };
+  auto writeChain = [&](const std::vector<unsigned char> &data) -> uint32_t
+  {
+    uint32_t start = END_OF_CHAIN;
+    uint32_t last = END_OF_CHAIN;
+    for (unsigned long offset = 0; offset < data.size(); offset += SECTOR_SIZE)
+    {
+      const uint32_t index = allocate(data, offset);
+      if (last == END_OF_CHAIN)
+        start = index;
+      else
+        fat[last] = index;
+      last = index;
+    }
+    return start;
+  };
+
+  std::vector<unsigned char> miniFatData(miniFat.size() * 4);
+  for (size_t i = 0; i < miniFat.size(); ++i)
+    putU32(miniFatData, 4 * i, miniFat[i]);
+  miniFatData.resize((miniFatData.size() + SECTOR_SIZE - 1) / SECTOR_SIZE * SECTOR_SIZE, 0xff);
+  const uint32_t miniFatStart = writeChain(miniFatData);
+  entries[0].start = writeChain(miniStream);
+  entries[0].content.resize(miniStream.size());
+
+  std::vector<TestEntry *> bigStreams;
+  for (auto &entry : entries)
+  {
+    if (entry.type == 2 && entry.content.size() >= MINI_STREAM_CUTOFF)
+      bigStreams.push_back(&entry);
+  }
+  if (bigStreams.size() >= 2)
+  {
+    TestEntry &first = *bigStreams[0];
+    TestEntry &second = *bigStreams[1];
+    uint32_t lastFirst = END_OF_CHAIN;
+    uint32_t lastSecond = END_OF_CHAIN;
+    for (unsigned long offset = 0; offset < first.content.size() || offset < second.content.size(); offset += SECTOR_SIZE)
+    {
+      if (offset < first.content.size())
+      {
+        const uint32_t index = allocate(first.content, offset);
+        if (lastFirst == END_OF_CHAIN)
+          first.start = index;
+        else
+          fat[lastFirst] = index;
+        lastFirst = index;
+      }
+      if (offset < second.content.size())
+      {
+        const uint32_t index = allocate(second.content, offset);
+        if (lastSecond == END_OF_CHAIN)
+          second.start = index;
+        else
+          fat[lastSecond] = index;
+        lastSecond = index;
+      }
+    }
+    bigStreams.erase(bigStreams.begin(), bigStreams.begin() + 2);
+  }
+  for (auto *entry : bigStreams)
+    entry->start = writeChain(entry->content);
+
+  // link the children of each storage into a degenerate tree, in order
+  std::vector<uint32_t> left(entries.size(), FREE_SECT);
+  std::vector<uint32_t> right(entries.size(), FREE_SECT);
+  std::vector<uint32_t> child(entries.size(), FREE_SECT);
+  for (unsigned parent = 0; parent < entries.size(); ++parent)
+  {
+    std::vector<TestEntry *> children;
+    for (unsigned i = 1; i < entries.size(); ++i)
+    {
+      if (entries[i].parent == parent)
+        children.push_back(&entries[i]);
+    }
+    if (children.empty())
+      continue;
+    std::sort(children.begin(), children.end(), compareNames);
+    child[parent] = uint32_t(children[0] - &entries[0]);
+    for (size_t i = 0; i + 1 < children.size(); ++i)
+      right[size_t(children[i] - &entries[0])] = uint32_t(children[i + 1] - &entries[0]);
+  }
+
+  std::vector<unsigned char> dir(numDirSectors * SECTOR_SIZE, 0);
+  for (unsigned i = 0; i < numDirSectors * entriesPerSector; ++i)
+  {
+    const unsigned long e = 128UL * i;
+    putU32(dir, e + 0x44, FREE_SECT);
+    putU32(dir, e + 0x48, FREE_SECT);
+    putU32(dir, e + 0x4c, FREE_SECT);
+    if (i >= entries.size())
+      continue;
+    const TestEntry &entry = entries[i];
+    for (size_t j = 0; j < entry.name.size(); ++j)
+      putU16(dir, e + 2 * j, (unsigned char)entry.name[j]);
+    putU16(dir, e + 0x40, unsigned(2 * (entry.name.size() + 1)));
+    dir[e + 0x42] = entry.type;
+    dir[e + 0x43] = 1;
+    putU32(dir, e + 0x44, left[i]);
+    putU32(dir, e + 0x48, right[i]);
+    putU32(dir, e + 0x4c, child[i]);
+    putU32(dir, e + 0x74, entry.type == 1 ? 0 : entry.start);
+    putU32(dir, e + 0x78, entry.type == 1 ? 0 : uint32_t(entry.content.size()));
+  }
+  for (unsigned i = 0; i < numDirSectors; ++i)
+    sectors[dirStart + i].assign(dir.begin() + long(i * SECTOR_SIZE), dir.begin() + long((i + 1) * SECTOR_SIZE));
+
+  std::vector<unsigned char> fatSector(SECTOR_SIZE, 0xff);
+  for (size_t i = 0; i < fat.size() && i < SECTOR_SIZE / 4; ++i)
+    putU32(fatSector, 4 * i, fat[i]);
+  sectors[0] = fatSector;
+
+  std::vector<unsigned char> header(SECTOR_SIZE, 0);
+  const unsigned char signature[] = { 0xd0, 0xcf, 0x11, 0xe0, 0xa1, 0xb1, 0x1a, 0xe1 };
+  std::copy(signature, signature + sizeof(signature), header.begin());
+  putU16(header, 0x18, 0x3e);
+  putU16(header, 0x1a, 3);
+  putU16(header, 0x1c, 0xfffe);
+  putU16(header, 0x1e, 9);
+  putU16(header, 0x20, 6);
+  putU32(header, 0x2c, 1);
+  putU32(header, 0x30, dirStart);
+  putU32(header, 0x38, MINI_STREAM_CUTOFF);
+  putU32(header, 0x3c, miniFat.empty() ? END_OF_CHAIN : miniFatStart);
+  putU32(header, 0x40, uint32_t(miniFatData.size() / SECTOR_SIZE));
+  putU32(header, 0x44, END_OF_CHAIN);
+  putU32(header, 0x48, 0);
+  for (unsigned i = 0; i < 109; ++i)
+    putU32(header, 0x4c + 4 * i, i == 0 ? 0 : FREE_SECT);
+
+  std::vector<unsigned char> file(header);
+  for (const auto &sector : sectors)
+    file.insert(file.end(), sector.begin(), sector.end());
+  return file;
+}
+
+bool readAll(librevenge::RVNGInputStream *input, std::vector<unsigned char> &out)
+{
+  out.clear();
+  if (!input || input->seek(0, librevenge::RVNG_SEEK_SET) != 0)
+    return false;
+  while (!input->isEnd())
+  {
+    unsigned long numBytesRead = 0;
+    const unsigned char *const p = input->read(4096, numBytesRead);
+    if (!p || numBytesRead == 0)
+      break;
+    out.insert(out.end(), p, p + numBytesRead);
+  }
+  return true;
+}
+
+bool readSubStream(librevenge::RVNGInputStream *input, const char *name, std::vector<unsigned char> &out)
+{
+  const std::unique_ptr<librevenge::RVNGInputStream> subStream(input->getSubStreamByName(name));
+  return readAll(subStream.get(), out);
+}
+
+std::set<std::string> getSubStreamNames(librevenge::RVNGInputStream *input)
+{
+  std::set<std::string> names;
+  for (unsigned i = 0; i < input->subStreamCount(); ++i)
+  {
+    const char *const name = input->subStreamName(i);
+    if (name)
+      names.insert(name);
+  }
+  return names;
+}
+
+int compareFile(const char *filename)
+{
+  libmspub::MappedFileStream mapped(filename);
+  librevenge::RVNGFileStream reference(filename);
+  if (!mapped.isValid())
+  {
+    fprintf(stderr, "%s: can not be mapped\n", filename);
+    return 1;
+  }
+  if (mapped.isStructured() != reference.isStructured())
+  {
+    fprintf(stderr, "%s: only one reader sees substreams\n", filename);
+    return 1;
+  }
+
+  int failures = 0;
+  std::vector<unsigned char> mappedData;
+  std::vector<unsigned char> referenceData;
+  readAll(&mapped, mappedData);
+  readAll(&reference, referenceData);
+  if (mappedData != referenceData)
+  {
+    fprintf(stderr, "%s: the file contents differ\n", filename);
+    ++failures;
+  }
+  if (!mapped.isStructured())
+    return failures;
+
+  const std::set<std::string> names = getSubStreamNames(&mapped);
+  for (const auto &name : getSubStreamNames(&reference))
+  {
+    if (!names.count(name) && !mapped.existsSubStream(name.c_str()))
+    {
+      fprintf(stderr, "%s: substream %s is missing\n", filename, name.c_str());
+      ++failures;
+    }
+  }
+  for (const auto &name : names)
+  {
+    if (!reference.existsSubStream(name.c_str()))
+      continue; // librevenge does not list storages without streams
+    if (!readSubStream(&mapped, name.c_str(), mappedData) || !readSubStream(&reference, name.c_str(), referenceData) || mappedData != referenceData)
+    {
+      fprintf(stderr, "%s: substream %s differs (%lu bytes against %lu)\n", filename, name.c_str(), (unsigned long)mappedData.size(), (unsigned long)referenceData.size());
+      ++failures;
+    }
+  }
+  return failures;
+}
+
+bool writeTestFile(const std::vector<unsigned char> &file)
+{
+  FILE *const f = fopen(TEST_FILE_NAME, "wb");
+  if (!f)
+  {
+    fprintf(stderr, "%s: can not be written\n", TEST_FILE_NAME);
+    return false;
+  }
+  const bool written = fwrite(file.data(), 1, file.size(), f) == file.size();
+  if (fclose(f) != 0 || !written)
+  {
+    fprintf(stderr, "%s: can not be written\n", TEST_FILE_NAME);
+    remove(TEST_FILE_NAME);
+    return false;
+  }
+  return true;
+}
+
+uint32_t getU32(const std::vector<unsigned char> &in, unsigned long offset)
+{
+  uint32_t value = 0;
+  for (unsigned i = 0; i < 4; ++i)
+    value |= uint32_t(in[offset + i]) << (8 * i);
+  return value;
+}
+
+/* Points the link after the n-th sector of a chain to next. The table
+ * (FAT or mini FAT) fills the sector at tableSector.
+ */
+void breakChain(std::vector<unsigned char> &file, uint32_t tableSector, uint32_t start, unsigned n, uint32_t next)
+{
+  const unsigned long table = (tableSector + 1UL) * SECTOR_SIZE;
+  uint32_t index = start;
+  for (unsigned i = 0; i < n; ++i)
+    index = getU32(file, table + 4UL * index);
+  putU32(file, table + 4UL * index, next);
+}
+
+/* Checks that a stream whose chain breaks reads as the part of it before
+ * the break, whether the chain leads out of the table, loops, or leads to
+ * a sector past the end of the file.
+ */
+int checkBrokenChains()
+{
+  std::vector<TestEntry> entries;
+  entries.push_back(TestEntry("Root Entry", 5, 0));
+  entries.push_back(TestEntry("Contents", 2, 0));
+  entries.back().content = makeContent(10000, 1);
+  entries.push_back(TestEntry("Escher", 2, 0));
+  entries.back().content = makeContent(6000, 2);
+  entries.push_back(TestEntry("Loop", 2, 0));
+  entries.back().content = makeContent(5000, 3);
+  entries.push_back(TestEntry("Quill", 2, 0));
+  entries.back().content = makeContent(300, 4);
+  entries.push_back(TestEntry("Whole", 2, 0));
+  entries.back().content = makeContent(200, 5);
+
+  std::vector<unsigned char> file = writeCompoundFile(entries);
+  const uint32_t miniFatSector = getU32(file, 0x3c);
+  // the FAT has room for 128 sectors, the file holds fewer
+  breakChain(file, 0, entries[1].start, 4, 0x10000);
+  breakChain(file, 0, entries[2].start, 2, 120);
+  breakChain(file, 0, entries[3].start, 6, entries[3].start);
+  breakChain(file, miniFatSector, entries[4].start, 1, 0x10000);
+  const unsigned long lengths[] = { 0, 5 * SECTOR_SIZE, 3 * SECTOR_SIZE, 7 * SECTOR_SIZE, 2 * MINI_SECTOR_SIZE, 200 };
+  if (!writeTestFile(file))
+    return 1;
+
+  int failures = 0;
+  {
+    libmspub::MappedFileStream mapped(TEST_FILE_NAME);
+    for (size_t i = 1; i < entries.size(); ++i)
+    {
+      const std::vector<unsigned char> expected(entries[i].content.begin(), entries[i].content.begin() + long(lengths[i]));
+      std::vector<unsigned char> data;
+      if (!mapped.existsSubStream(entries[i].name.c_str()) || !readSubStream(&mapped, entries[i].name.c_str(), data) || data != expected)
+      {
+        fprintf(stderr, "%s: MappedFileStream reads %lu bytes of broken %s, expected %lu\n", TEST_FILE_NAME, (unsigned long)data.size(), entries[i].name.c_str(), lengths[i]);
+        ++failures;
+      }
+    }
+  }
+  remove(TEST_FILE_NAME);
+  return failures;
+}
+
+int checkTestFile()
+{
+  std::vector<TestEntry> entries;
+  entries.push_back(TestEntry("Root Entry", 5, 0));
+  entries.push_back(TestEntry("Contents", 2, 0));
+  entries.back().content = makeContent(10000, 1);
+  entries.push_back(TestEntry("Escher", 1, 0));
+  const unsigned escher = unsigned(entries.size() - 1);
+  entries.push_back(TestEntry("EscherStm", 2, escher));
+  entries.back().content = makeContent(6000, 2);
+  entries.push_back(TestEntry("EscherDelayStm", 2, escher));
+  entries.back().content = makeContent(5000, 3);
+  entries.push_back(TestEntry("Quill", 1, 0));
+  entries.push_back(TestEntry("QuillSub", 1, unsigned(entries.size() - 1)));
+  entries.push_back(TestEntry("CONTENTS", 2, unsigned(entries.size() - 1)));
+  entries.back().content = makeContent(300, 4);
+  entries.push_back(TestEntry("\005SummaryInformation", 2, 0));
+  entries.back().content = makeContent(100, 5);
+
+  if (!writeTestFile(writeCompoundFile(entries)))
+    return 1;
+
+  int failures = 0;
+  {
+    libmspub::MappedFileStream mapped(TEST_FILE_NAME);
+    librevenge::RVNGFileStream reference(TEST_FILE_NAME);
+    const char *const paths[] = { "Contents", "Escher/EscherStm", "Escher/EscherDelayStm", "Quill/QuillSub/CONTENTS", "\005SummaryInformation" };
+    const size_t indices[] = { 1, 3, 4, 7, 8 };
+    for (size_t i = 0; i < sizeof(paths) / sizeof(paths[0]); ++i)
+    {
+      std::vector<unsigned char> data;
+      if (!readSubStream(&mapped, paths[i], data) || data != entries[indices[i]].content)
+      {
+        fprintf(stderr, "%s: MappedFileStream misreads %s\n", TEST_FILE_NAME, paths[i]);
+        ++failures;
+      }
+      if (!readSubStream(&reference, paths[i], data) || data != entries[indices[i]].content)
+      {
+        fprintf(stderr, "%s: RVNGFileStream misreads %s\n", TEST_FILE_NAME, paths[i]);
+        ++failures;
+      }
+    }
+  }
+  failures += compareFile(TEST_FILE_NAME);
+  remove(TEST_FILE_NAME);
+  return failures;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+  int failures = checkTestFile();
+  failures += checkBrokenChains();
+  for (int i = 1; i < argc; ++i)
+    failures += compareFile(argv[i]);
+  if (failures)
+    fprintf(stderr, "%d failures\n", failures);
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -11,6 +11,7 @@
 #include "config.h"
 #endif
 
+#include <memory>
 #include <stdio.h>
 #include <string.h>
 
@@ -19,6 +20,8 @@
 #include <librevenge/librevenge.h>
 #include <libmspub/libmspub.h>
 
+#include "MappedFileStream.h"
+
 #ifndef PACKAGE
 #define PACKAGE "libmspub"
 #endif
@@ -75,16 +78,25 @@ int main(int argc, char *argv[])
   if (!file)
     return printUsage();
 
-  librevenge::RVNGFileStream input(file);
+  libmspub::MappedFileStream mappedInput(file);
+  std::unique_ptr<librevenge::RVNGFileStream> fileInput;
+  librevenge::RVNGInputStream *input = &mappedInput;
+  if (!mappedInput.isValid())
+  {
+    // e.g. a pipe or an empty file: fall back to reading it into memory
+    fileInput.reset(new librevenge::RVNGFileStream(file));
+    input = fileInput.get();
+  }
 
-  if (!libmspub::MSPUBDocument::isSupported(&input))
+  const std::unique_ptr<libmspub::MSPUBDocument> document(libmspub::MSPUBDocument::open(input));
+  if (!document)
   {
     fprintf(stderr, "ERROR: Unsupported file format!\n");
     return 1;
   }
 
   librevenge::RVNGRawDrawingGenerator painter(printIndentLevel);
-  libmspub::MSPUBDocument::parse(&input, &painter);
+  document->parse(&painter);
 
   return 0;
 }
@@ -13,12 +13,15 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <stdio.h>
 #include <string.h>
 #include <librevenge-stream/librevenge-stream.h>
 #include <librevenge/librevenge.h>
 #include <libmspub/libmspub.h>
 
+#include "MappedFileStream.h"
+
 #ifndef VERSION
 #define VERSION "UNKNOWN VERSION"
 #endif
@@ -76,13 +79,22 @@ int main(int argc, char *argv[])
   if (!in_file)
     return printUsage();
 
-  librevenge::RVNGFileStream input(in_file);
+  libmspub::MappedFileStream mappedInput(in_file);
+  std::unique_ptr<librevenge::RVNGFileStream> fileInput;
+  librevenge::RVNGInputStream *input = &mappedInput;
+  if (!mappedInput.isValid())
+  {
+    // e.g. a pipe or an empty file: fall back to reading it into memory
+    fileInput.reset(new librevenge::RVNGFileStream(in_file));
+    input = fileInput.get();
+  }
   std::ofstream o;
   if (out_file)
     o.open(out_file);
   std::ostream &output = out_file ? o : std::cout;
 
-  if (!libmspub::MSPUBDocument::isSupported(&input))
+  const std::unique_ptr<libmspub::MSPUBDocument> document(libmspub::MSPUBDocument::open(input));
+  if (!document)
   {
     std::cerr << "ERROR: Unsupported file format!" << std::endl;
     return 1;
@@ -90,7 +102,7 @@ int main(int argc, char *argv[])
 
   librevenge::RVNGStringVector outputStrings;
   librevenge::RVNGSVGDrawingGenerator generator(outputStrings, "svg");
-  if (!libmspub::MSPUBDocument::parse(&input, &generator))
+  if (!document->parse(&generator))
   {
     std::cerr << "ERROR: SVG Generation failed!" << std::endl;
     return 1;
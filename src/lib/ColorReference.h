@@ -29,6 +29,14 @@ public:
   explicit ColorReference(unsigned color) : m_baseColor(color), m_modifiedColor(color) { }
   ColorReference(unsigned baseColor, unsigned modifiedColor) : m_baseColor(baseColor), m_modifiedColor(modifiedColor) { }
   Color getFinalColor(const std::vector<Color> &palette) const;
+  unsigned getBaseColor() const
+  {
+    return m_baseColor;
+  }
+  unsigned getModifiedColor() const
+  {
+    return m_modifiedColor;
+  }
 public:
   friend bool operator==(const libmspub::ColorReference &, const libmspub::ColorReference &);
 };
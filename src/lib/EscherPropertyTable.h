@@ -0,0 +1,127 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_ESCHERPROPERTYTABLE_H
+#define INCLUDED_ESCHERPROPERTYTABLE_H
+
+#include <algorithm>
+
+#include <boost/container/small_vector.hpp>
+
+namespace libmspub
+{
+
+// A view of bytes owned by someone else, usually the buffer of the stream
+// being parsed. It is only valid as long as that buffer is.
+class ByteView
+{
+public:
+  ByteView() : m_data(nullptr), m_size(0)
+  {
+  }
+  ByteView(const unsigned char *data, unsigned long size)
+    : m_data(data), m_size(data ? size : 0)
+  {
+  }
+
+  const unsigned char *data() const
+  {
+    return m_data;
+  }
+  unsigned long size() const
+  {
+    return m_size;
+  }
+  bool empty() const
+  {
+    return m_size == 0;
+  }
+  unsigned char operator[](unsigned long i) const
+  {
+    return m_data[i];
+  }
+
+private:
+  const unsigned char *m_data;
+  unsigned long m_size;
+};
+
+/* The properties of one Escher record, sorted by id. Records set a few
+ * dozen properties at most, so they are kept in a small inline buffer
+ * rather than in a map; a record parses without touching the heap. Setting
+ * an id that is already present replaces its value.
+ */
+template <typename T, unsigned N>
+class EscherPropertyTable
+{
+  struct Entry
+  {
+    unsigned short m_id;
+    T m_value;
+  };
+
+  struct EntryIdLess
+  {
+    bool operator()(const Entry &entry, unsigned short id) const
+    {
+      return entry.m_id < id;
+    }
+  };
+
+public:
+  EscherPropertyTable() : m_entries()
+  {
+  }
+
+  void set(unsigned short id, const T &value)
+  {
+    // properties are normally stored in increasing order of id
+    if (m_entries.empty() || m_entries.back().m_id < id)
+    {
+      m_entries.push_back(Entry{id, value});
+      return;
+    }
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), id, EntryIdLess());
+    if (it != m_entries.end() && it->m_id == id)
+      it->m_value = value;
+    else
+      m_entries.insert(it, Entry{id, value});
+  }
+
+  const T *find(unsigned short id) const
+  {
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), id, EntryIdLess());
+    if (it != m_entries.end() && it->m_id == id)
+      return &it->m_value;
+    return nullptr;
+  }
+
+  // the value of id, or a default-constructed one if it is not set
+  T get(unsigned short id) const
+  {
+    const T *const value = find(id);
+    return value ? *value : T();
+  }
+
+  bool empty() const
+  {
+    return m_entries.empty();
+  }
+
+private:
+  boost::container::small_vector<Entry, N> m_entries;
+};
+
+typedef EscherPropertyTable<unsigned, 32> EscherValues;
+typedef EscherPropertyTable<ByteView, 4> EscherComplexValues;
+
+}
+
+#endif // INCLUDED_ESCHERPROPERTYTABLE_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -12,28 +12,25 @@
 #include <utility>
 
 #include "FillType.h"
-#include "MSPUBCollector.h"
+#include "MSPUBDocumentModel.h"
+#include "MSPUBEmitter.h"
 #include "libmspub_utils.h"
 
 namespace libmspub
 {
 
-Fill::Fill(const MSPUBCollector *owner) : m_owner(owner)
+ImgFill::ImgFill(unsigned imgIndex, bool isTexture, int rot) : Fill(), m_imgIndex(imgIndex), m_isTexture(isTexture), m_rotation(rot)
 {
 }
 
-ImgFill::ImgFill(unsigned imgIndex, const MSPUBCollector *owner, bool isTexture, int rot) : Fill(owner), m_imgIndex(imgIndex), m_isTexture(isTexture), m_rotation(rot)
-{
-}
-
-void ImgFill::getProperties(librevenge::RVNGPropertyList *out) const
+void ImgFill::getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const
 {
   out->insert("draw:fill", "bitmap");
-  if (m_imgIndex > 0 && m_imgIndex <= m_owner->m_images.size())
+  if (m_imgIndex > 0 && m_imgIndex <= model.m_images.size())
   {
-    const std::pair<ImgType, librevenge::RVNGBinaryData> &img = m_owner->m_images[m_imgIndex - 1];
-    out->insert("librevenge:mime-type", mimeByImgType(img.first));
-    out->insert("draw:fill-image", img.second.getBase64Data());
+    const ImgInfo &img = model.m_images[m_imgIndex - 1];
+    out->insert("librevenge:mime-type", mimeByImgType(img.getType()));
+    out->insert("draw:fill-image", img.getData().getBase64Data());
     out->insert("draw:fill-image-ref-point", "top-left");
     if (! m_isTexture)
     {
@@ -48,20 +45,20 @@ void ImgFill::getProperties(librevenge::RVNGPropertyList *out) const
   }
 }
 
-PatternFill::PatternFill(unsigned imgIndex, const MSPUBCollector *owner, ColorReference fg, ColorReference bg) : ImgFill(imgIndex, owner, true, 0), m_fg(fg), m_bg(bg)
+PatternFill::PatternFill(unsigned imgIndex, ColorReference fg, ColorReference bg) : ImgFill(imgIndex, true, 0), m_fg(fg), m_bg(bg)
 {
 }
 
-void PatternFill::getProperties(librevenge::RVNGPropertyList *out) const
+void PatternFill::getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const
 {
-  Color fgColor = m_fg.getFinalColor(m_owner->m_paletteColors);
-  Color bgColor = m_bg.getFinalColor(m_owner->m_paletteColors);
+  Color fgColor = m_fg.getFinalColor(model.m_paletteColors);
+  Color bgColor = m_bg.getFinalColor(model.m_paletteColors);
   out->insert("draw:fill", "bitmap");
-  if (m_imgIndex > 0 && m_imgIndex <= m_owner->m_images.size())
+  if (m_imgIndex > 0 && m_imgIndex <= model.m_images.size())
   {
-    const std::pair<ImgType, librevenge::RVNGBinaryData> &img = m_owner->m_images[m_imgIndex - 1];
-    const ImgType &type = img.first;
-    const librevenge::RVNGBinaryData *data = &img.second;
+    const ImgInfo &img = model.m_images[m_imgIndex - 1];
+    const ImgType type = img.getType();
+    const librevenge::RVNGBinaryData *data = &img.getData();
     // fix broken MSPUB DIB by putting in correct fg and bg colors
     librevenge::RVNGBinaryData fixedImg;
     if (type == DIB && data->size() >= 0x36 + 8)
@@ -84,22 +81,22 @@ void PatternFill::getProperties(librevenge::RVNGPropertyList *out) const
   }
 }
 
-SolidFill::SolidFill(ColorReference color, double opacity, const MSPUBCollector *owner) : Fill(owner), m_color(color), m_opacity(opacity)
+SolidFill::SolidFill(ColorReference color, double opacity) : Fill(), m_color(color), m_opacity(opacity)
 {
 }
 
-void SolidFill::getProperties(librevenge::RVNGPropertyList *out) const
+void SolidFill::getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const
 {
-  Color fillColor = m_color.getFinalColor(m_owner->m_paletteColors);
+  Color fillColor = m_color.getFinalColor(model.m_paletteColors);
   out->insert("draw:fill", "solid");
-  out->insert("draw:fill-color", MSPUBCollector::getColorString(fillColor));
+  out->insert("draw:fill-color", MSPUBEmitter::getColorString(fillColor));
   librevenge::RVNGString val;
   val.sprintf("%d%%", (int)(m_opacity * 100));
   out->insert("draw:opacity", val);
   out->insert("svg:fill-rule", "nonzero");
 }
 
-GradientFill::GradientFill(const MSPUBCollector *owner, double angle, int type) : Fill(owner), m_stops(), m_angle(angle), m_type(type), m_fillLeftVal(0.0), m_fillTopVal(0.0), m_fillRightVal(0.0), m_fillBottomVal(0.0)
+GradientFill::GradientFill(double angle, int type) : Fill(), m_stops(), m_angle(angle), m_type(type), m_fillLeftVal(0.0), m_fillTopVal(0.0), m_fillRightVal(0.0), m_fillBottomVal(0.0)
 {
 }
 
@@ -111,6 +108,14 @@ void GradientFill::setFillCenter(double left, double top, double right, double b
   m_fillBottomVal = bottom;
 }
 
+void GradientFill::getFillCenter(double &left, double &top, double &right, double &bottom) const
+{
+  left = m_fillLeftVal;
+  top = m_fillTopVal;
+  right = m_fillRightVal;
+  bottom = m_fillBottomVal;
+}
+
 void GradientFill::addColor(ColorReference c, unsigned offsetPercent, double opacity)
 {
   m_stops.push_back(StopInfo(c, offsetPercent, opacity));
@@ -131,7 +136,7 @@ void GradientFill::completeComplexFill()
   }
 }
 
-void GradientFill::getProperties(librevenge::RVNGPropertyList *out) const
+void GradientFill::getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const
 {
   librevenge::RVNGPropertyListVector ret;
   out->insert("draw:fill", "gradient");
@@ -161,12 +166,12 @@ void GradientFill::getProperties(librevenge::RVNGPropertyList *out) const
   }
   for (const auto &stop : m_stops)
   {
-    Color c = stop.m_colorReference.getFinalColor(m_owner->m_paletteColors);
+    Color c = stop.m_colorReference.getFinalColor(model.m_paletteColors);
     librevenge::RVNGPropertyList stopProps;
     librevenge::RVNGString sValue;
     sValue.sprintf("%d%%", stop.m_offsetPercent);
     stopProps.insert("svg:offset", sValue);
-    stopProps.insert("svg:stop-color", MSPUBCollector::getColorString(c));
+    stopProps.insert("svg:stop-color", MSPUBEmitter::getColorString(c));
     sValue.sprintf("%d%%", (int)(stop.m_opacity * 100));
     stopProps.insert("svg:stop-opacity", sValue);
     ret.append(stopProps);
@@ -18,17 +18,16 @@
 
 namespace libmspub
 {
-class MSPUBCollector;
+struct MSPUBDocumentModel;
 class Fill
 {
-protected:
-  const MSPUBCollector *m_owner;
 public:
-  Fill(const MSPUBCollector *owner);
-  virtual void getProperties(librevenge::RVNGPropertyList *out) const = 0;
+  Fill() { }
+  // the model provides the palette and images that the fill refers to
+  virtual void getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const = 0;
   virtual ~Fill() { }
 private:
-  Fill(const Fill &) : m_owner(nullptr) { }
+  Fill(const Fill &) { }
   Fill &operator=(const Fill &);
 };
 
@@ -41,10 +40,22 @@ private:
 protected:
   int m_rotation;
 public:
-  ImgFill(unsigned imgIndex, const MSPUBCollector *owner, bool isTexture, int rotation);
-  void getProperties(librevenge::RVNGPropertyList *out) const override;
+  ImgFill(unsigned imgIndex, bool isTexture, int rotation);
+  void getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const override;
+  unsigned getImgIndex() const
+  {
+    return m_imgIndex;
+  }
+  bool isTexture() const
+  {
+    return m_isTexture;
+  }
+  int getRotation() const
+  {
+    return m_rotation;
+  }
 private:
-  ImgFill(const ImgFill &) : Fill(nullptr), m_imgIndex(0), m_isTexture(false), m_rotation(0) { }
+  ImgFill(const ImgFill &) : Fill(), m_imgIndex(0), m_isTexture(false), m_rotation(0) { }
   ImgFill &operator=(const ImgFill &);
 };
 
@@ -53,10 +64,18 @@ class PatternFill : public ImgFill
   ColorReference m_fg;
   ColorReference m_bg;
 public:
-  PatternFill(unsigned imgIndex, const MSPUBCollector *owner, ColorReference fg, ColorReference bg);
-  void getProperties(librevenge::RVNGPropertyList *out) const override;
+  PatternFill(unsigned imgIndex, ColorReference fg, ColorReference bg);
+  void getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const override;
+  ColorReference getForeground() const
+  {
+    return m_fg;
+  }
+  ColorReference getBackground() const
+  {
+    return m_bg;
+  }
 private:
-  PatternFill(const PatternFill &) : ImgFill(0, nullptr, true, 0), m_fg(0x08000000), m_bg(0x08000000) { }
+  PatternFill(const PatternFill &) : ImgFill(0, true, 0), m_fg(0x08000000), m_bg(0x08000000) { }
   PatternFill &operator=(const ImgFill &);
 };
 
@@ -65,15 +84,24 @@ class SolidFill : public Fill
   ColorReference m_color;
   double m_opacity;
 public:
-  SolidFill(ColorReference color, double opacity, const MSPUBCollector *owner);
-  void getProperties(librevenge::RVNGPropertyList *out) const override;
+  SolidFill(ColorReference color, double opacity);
+  void getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const override;
+  ColorReference getColor() const
+  {
+    return m_color;
+  }
+  double getOpacity() const
+  {
+    return m_opacity;
+  }
 private:
-  SolidFill(const SolidFill &) : Fill(nullptr), m_color(0x08000000), m_opacity(1) { }
+  SolidFill(const SolidFill &) : Fill(), m_color(0x08000000), m_opacity(1) { }
   SolidFill &operator=(const SolidFill &);
 };
 
 class GradientFill : public Fill
 {
+public:
   struct StopInfo
   {
     ColorReference m_colorReference;
@@ -81,6 +109,7 @@ class GradientFill : public Fill
     double m_opacity;
     StopInfo(ColorReference colorReference, unsigned offsetPercent, double opacity) : m_colorReference(colorReference), m_offsetPercent(offsetPercent), m_opacity(opacity) { }
   };
+private:
   std::vector<StopInfo> m_stops;
   double m_angle;
   int m_type;
@@ -89,14 +118,27 @@ class GradientFill : public Fill
   double m_fillRightVal;
   double m_fillBottomVal;
 public:
-  GradientFill(const MSPUBCollector *owner, double angle = 0, int type = 7);
+  GradientFill(double angle = 0, int type = 7);
   void setFillCenter(double left, double top, double right, double bottom);
   void addColor(ColorReference c, unsigned offsetPercent, double opacity);
   void addColorReverse(ColorReference c, unsigned offsetPercent, double opacity);
   void completeComplexFill();
-  void getProperties(librevenge::RVNGPropertyList *out) const override;
+  void getProperties(librevenge::RVNGPropertyList *out, const MSPUBDocumentModel &model) const override;
+  double getAngle() const
+  {
+    return m_angle;
+  }
+  int getType() const
+  {
+    return m_type;
+  }
+  void getFillCenter(double &left, double &top, double &right, double &bottom) const;
+  const std::vector<StopInfo> &getStops() const
+  {
+    return m_stops;
+  }
 private:
-  GradientFill(const GradientFill &) : Fill(nullptr), m_stops(), m_angle(0), m_type(7), m_fillLeftVal(0.0), m_fillTopVal(0.0), m_fillRightVal(0.0), m_fillBottomVal(0.0) { }
+  GradientFill(const GradientFill &) : Fill(), m_stops(), m_angle(0), m_type(7), m_fillLeftVal(0.0), m_fillTopVal(0.0), m_fillRightVal(0.0), m_fillBottomVal(0.0) { }
   GradientFill &operator=(const GradientFill &);
 };
 }
@@ -0,0 +1,109 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ImgInfo.h"
+
+#include <algorithm>
+
+#include "MSPUBMemoryStream.h"
+#include "libmspub_utils.h"
+
+namespace libmspub
+{
+
+ImgInfo::ImgInfo()
+  : m_type(UNKNOWN), m_stream(nullptr), m_offset(0), m_length(0), m_sizeHint(0), m_decoded(std::make_shared<Decoded>())
+{
+}
+
+ImgInfo::ImgInfo(ImgType type, const librevenge::RVNGBinaryData &data)
+  : m_type(type), m_stream(nullptr), m_offset(0), m_length(0), m_sizeHint(0), m_decoded(std::make_shared<Decoded>())
+{
+  std::call_once(m_decoded->m_once, [&]()
+  {
+    m_decoded->m_data = data;
+  });
+}
+
+ImgInfo::ImgInfo(ImgType type, const MSPUBMemoryStream *stream, unsigned long offset, unsigned long length, unsigned long sizeHint)
+  : m_type(type), m_stream(stream), m_offset(offset), m_length(length), m_sizeHint(sizeHint), m_decoded(std::make_shared<Decoded>())
+{
+}
+
+const librevenge::RVNGBinaryData &ImgInfo::getData() const
+{
+  std::call_once(m_decoded->m_once, [this]()
+  {
+    m_decoded->m_data = decode();
+  });
+  return m_decoded->m_data;
+}
+
+librevenge::RVNGBinaryData ImgInfo::decode() const
+{
+  librevenge::RVNGBinaryData img;
+  if (!m_stream || m_offset >= m_stream->size())
+    return img;
+  const unsigned char *const data = m_stream->getDataBuffer() + m_offset;
+  const unsigned long length = std::min(m_length, m_stream->size() - m_offset);
+  switch (m_type)
+  {
+  case WMF:
+  case EMF:
+    return inflateData(data, length, m_sizeHint);
+  case DIB:
+  {
+    if (length < 0x2E + 4)
+      return img;
+    SpanReader dibHeader(data, length);
+    dibHeader.seekRelative(0x0E);
+    unsigned short bitsPerPixel = dibHeader.readU16();
+    dibHeader.seekRelative(0x20);
+    unsigned numPaletteColors = dibHeader.readU32();
+    if (numPaletteColors == 0 && bitsPerPixel <= 8)
+    {
+      numPaletteColors = 1;
+      for (int i = 0; i < bitsPerPixel; ++i)
+      {
+        numPaletteColors *= 2;
+      }
+    }
+
+    // Reconstruct BMP header
+    // cf. http://en.wikipedia.org/wiki/BMP_file_format , accessed 2012-5-31
+    img.append((unsigned char)0x42);
+    img.append((unsigned char)0x4d);
+
+    img.append((unsigned char)((length + 14) & 0x000000ff));
+    img.append((unsigned char)(((length + 14) & 0x0000ff00) >> 8));
+    img.append((unsigned char)(((length + 14) & 0x00ff0000) >> 16));
+    img.append((unsigned char)(((length + 14) & 0xff000000) >> 24));
+
+    img.append((unsigned char)0x00);
+    img.append((unsigned char)0x00);
+    img.append((unsigned char)0x00);
+    img.append((unsigned char)0x00);
+
+    img.append((unsigned char)(0x36 + 4 * numPaletteColors));
+    img.append((unsigned char)0x00);
+    img.append((unsigned char)0x00);
+    img.append((unsigned char)0x00);
+    img.append(data, length);
+    return img;
+  }
+  default:
+    if (length)
+      img.append(data, length);
+    return img;
+  }
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
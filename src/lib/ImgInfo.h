@@ -0,0 +1,83 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_IMGINFO_H
+#define INCLUDED_IMGINFO_H
+
+#include <memory>
+#include <mutex>
+
+#include <librevenge/librevenge.h>
+
+#include "MSPUBTypes.h"
+
+namespace libmspub
+{
+class MSPUBMemoryStream;
+
+/* An image of the document. Blips from the delay stream are only recorded
+ * by their position in it and decoded the first time they are painted, so
+ * images that no shape uses are never inflated or copied. Copies share the
+ * decoded data, and it is decoded only once even if several threads paint
+ * the image at the same time.
+ */
+class ImgInfo
+{
+public:
+  ImgInfo();
+  ImgInfo(ImgType type, const librevenge::RVNGBinaryData &data);
+  // The stream must outlive this object; sizeHint is the uncompressed
+  // size of a metafile, if known.
+  ImgInfo(ImgType type, const MSPUBMemoryStream *stream, unsigned long offset, unsigned long length, unsigned long sizeHint);
+
+  ImgType getType() const
+  {
+    return m_type;
+  }
+  const librevenge::RVNGBinaryData &getData() const;
+
+  // Whether the image is a blip of the delay stream; then the offset,
+  // length and size hint it was created with say where to find it again.
+  bool isDelayed() const
+  {
+    return m_stream != nullptr;
+  }
+  unsigned long getOffset() const
+  {
+    return m_offset;
+  }
+  unsigned long getLength() const
+  {
+    return m_length;
+  }
+  unsigned long getSizeHint() const
+  {
+    return m_sizeHint;
+  }
+
+private:
+  struct Decoded
+  {
+    std::once_flag m_once;
+    librevenge::RVNGBinaryData m_data;
+  };
+
+  librevenge::RVNGBinaryData decode() const;
+
+  ImgType m_type;
+  const MSPUBMemoryStream *m_stream;
+  unsigned long m_offset;
+  unsigned long m_length;
+  unsigned long m_sizeHint;
+  std::shared_ptr<Decoded> m_decoded;
+};
+}
+
+#endif // INCLUDED_IMGINFO_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
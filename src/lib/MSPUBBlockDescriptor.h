@@ -0,0 +1,75 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MSPUBBLOCKDESCRIPTOR_H
+#define INCLUDED_MSPUBBLOCKDESCRIPTOR_H
+
+#include "MSPUBBlockType.h"
+
+namespace libmspub
+{
+
+// How the data of each type of block in the Contents stream is laid out.
+
+enum BlockKind
+{
+  BLOCK_INLINE, // at most 4 bytes of integral data
+  BLOCK_OPAQUE, // fixed-length data that is not read
+  BLOCK_HIERARCHICAL, // sub-blocks, preceded by the data length
+  BLOCK_STRING, // preceded by the data length
+  BLOCK_UNKNOWN // treated as having no data
+};
+
+struct BlockDescriptor
+{
+  BlockKind m_kind;
+  unsigned char m_dataLength; // of fixed-length blocks
+  unsigned char m_inlineLength; // bytes read along with the block header
+};
+
+constexpr BlockDescriptor fixedLengthBlock(unsigned char length)
+{
+  return length <= 4 ? BlockDescriptor{BLOCK_INLINE, length, length} : BlockDescriptor{BLOCK_OPAQUE, length, 0};
+}
+
+constexpr BlockDescriptor describeBlock(unsigned type)
+{
+  return (type == DUMMY || type == 0x5 || type == 0x8 || type == 0xa) ? fixedLengthBlock(0)
+         : (type == 0x10 || type == 0x12 || type == 0x18 || type == 0x1a || type == 0x07) ? fixedLengthBlock(2)
+         : (type == 0x20 || type == 0x22 || type == 0x58 || type == 0x68 || type == 0x70 || type == 0xb8) ? fixedLengthBlock(4)
+         : type == 0x28 ? fixedLengthBlock(8)
+         : type == 0x38 ? fixedLengthBlock(16)
+         : type == 0x48 ? fixedLengthBlock(24)
+         : type == STRING_CONTAINER ? BlockDescriptor{BLOCK_STRING, 0, 4}
+         : (type == 0x80 || type == 0x82 || type == GENERAL_CONTAINER || type == 0x8a || type == 0x90 || type == 0x98 || type == 0xa0)
+         ? BlockDescriptor{BLOCK_HIERARCHICAL, 0, 4}
+         : BlockDescriptor{BLOCK_UNKNOWN, 0, 0};
+}
+
+#define DESCRIBE_4_BLOCKS(t) describeBlock(t), describeBlock(t + 1), describeBlock(t + 2), describeBlock(t + 3)
+#define DESCRIBE_16_BLOCKS(t) DESCRIBE_4_BLOCKS(t), DESCRIBE_4_BLOCKS(t + 4), DESCRIBE_4_BLOCKS(t + 8), DESCRIBE_4_BLOCKS(t + 12)
+#define DESCRIBE_64_BLOCKS(t) DESCRIBE_16_BLOCKS(t), DESCRIBE_16_BLOCKS(t + 16), DESCRIBE_16_BLOCKS(t + 32), DESCRIBE_16_BLOCKS(t + 48)
+
+// indexed by block type, which is a byte
+constexpr BlockDescriptor BLOCK_DESCRIPTORS[256] =
+{
+  DESCRIBE_64_BLOCKS(0), DESCRIBE_64_BLOCKS(64), DESCRIBE_64_BLOCKS(128), DESCRIBE_64_BLOCKS(192)
+};
+
+#undef DESCRIBE_64_BLOCKS
+#undef DESCRIBE_16_BLOCKS
+#undef DESCRIBE_4_BLOCKS
+
+static_assert(BLOCK_DESCRIPTORS[GENERAL_CONTAINER].m_kind == BLOCK_HIERARCHICAL, "general containers hold sub-blocks");
+static_assert(BLOCK_DESCRIPTORS[SHAPE_SEQNUM].m_inlineLength == 4, "shape seqnums are DWORDs");
+
+} // namespace libmspub
+
+#endif /* INCLUDED_MSPUBBLOCKDESCRIPTOR_H */
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -21,6 +21,8 @@
 #include "BorderArtInfo.h"
 #include "ColorReference.h"
 #include "EmbeddedFontInfo.h"
+#include "ImgInfo.h"
+#include "MSPUBDocumentModel.h"
 #include "MSPUBTypes.h"
 #include "PolygonUtils.h"
 #include "ShapeInfo.h"
@@ -32,10 +34,8 @@ namespace libmspub
 
 class Fill;
 class ShapeGroupElement;
-class VectorTransformation2D;
 
 struct Arrow;
-struct Coordinate;
 struct Dash;
 struct Line;
 struct Shadow;
@@ -43,15 +43,10 @@ struct TableInfo;
 
 class MSPUBCollector
 {
-  friend class Fill;
-  friend class ImgFill;
-  friend class SolidFill;
-  friend class GradientFill;
-  friend class PatternFill;
 public:
   typedef std::list<ContentChunkReference>::const_iterator ccr_iterator_t;
 
-  MSPUBCollector(librevenge::RVNGDrawingInterface *painter);
+  MSPUBCollector();
   virtual ~MSPUBCollector();
 
   // collector functions
@@ -60,7 +55,7 @@ public:
   bool addPage(unsigned seqNum);
   bool addTextString(const std::vector<TextParagraph> &str, unsigned id);
   void addTextShape(unsigned stringId, unsigned seqNum);
-  bool addImage(unsigned index, ImgType type, librevenge::RVNGBinaryData img);
+  bool addImage(unsigned index, const ImgInfo &img);
   void setBorderImageOffset(unsigned index, unsigned offset);
   librevenge::RVNGBinaryData *addBorderImage(ImgType type, unsigned borderArtIndex);
   void setShapePage(unsigned seqNum, unsigned pageSeqNum);
@@ -124,82 +119,36 @@ public:
   void setTableCellTextEnds(unsigned textId, const std::vector<unsigned> &ends);
   void setTextStringOffset(unsigned textId, unsigned offset);
 
+  // Restricts emission to the pages firstPage to lastPage. Pages are
+  // counted from 1 in the order they are emitted; master pages are not
+  // counted, but are emitted with the pages that use them.
+  void setPageRange(unsigned firstPage, unsigned lastPage);
+  bool hasPageRange() const;
+  // the seqnums of the selected pages, their master pages, and the shapes
+  // on them; only valid once the pages have been parsed
+  std::set<unsigned> getSelectedSeqNums() const;
+  std::set<unsigned> getShapeTextIds() const;
+
+  // completes the model once all the parsers are done
   bool go();
+  // the model to emit (see MSPUBEmitter), once go() has completed it
+  const MSPUBDocumentModel &getModel() const;
+  // for filling the model in place of the parsers (see MSPUBParseCache)
+  MSPUBDocumentModel &getModel();
 
   bool hasPage(unsigned seqNum) const;
 private:
-
-  struct PageInfo
-  {
-    std::vector<std::shared_ptr<ShapeGroupElement>> m_shapeGroupsOrdered;
-    PageInfo() : m_shapeGroupsOrdered() { }
-  };
-
   MSPUBCollector(const MSPUBCollector &);
   MSPUBCollector &operator=(const MSPUBCollector &);
 
-  librevenge::RVNGDrawingInterface *m_painter;
-  std::list<ContentChunkReference> m_contentChunkReferences;
-  double m_width, m_height;
-  bool m_widthSet, m_heightSet;
-  unsigned short m_numPages;
-  std::map<unsigned, std::vector<TextParagraph> > m_textStringsById;
-  std::map<unsigned, PageInfo> m_pagesBySeqNum;
-  std::vector<std::pair<ImgType, librevenge::RVNGBinaryData> > m_images;
-  std::vector<BorderArtInfo> m_borderImages;
-  std::vector<ColorReference> m_textColors;
-  std::vector<std::vector<unsigned char> > m_fonts;
-  std::vector<CharacterStyle> m_defaultCharStyles;
-  std::vector<ParagraphStyle> m_defaultParaStyles;
-  std::map<unsigned, ShapeType> m_shapeTypesBySeqNum;
-  std::vector<Color> m_paletteColors;
-  std::vector<unsigned> m_shapeSeqNumsOrdered;
-  std::map<unsigned, unsigned> m_pageSeqNumsByShapeSeqNum;
-  std::map<unsigned, unsigned> m_bgShapeSeqNumsByPageSeqNum;
-  std::set<unsigned> m_skipIfNotBgSeqNums;
+  MSPUBDocumentModel m_model;
   std::shared_ptr<ShapeGroupElement> m_currentShapeGroup;
-  std::vector<std::shared_ptr<ShapeGroupElement>> m_topLevelShapes;
-  std::map<unsigned, std::shared_ptr<ShapeGroupElement>> m_groupsBySeqNum;
-  std::list<EmbeddedFontInfo> m_embeddedFonts;
-  std::map<unsigned, ShapeInfo> m_shapeInfosBySeqNum;
-  std::set<unsigned> m_masterPages;
-  std::set<unsigned> m_shapesWithCoordinatesRotated90;
-  std::map<unsigned, unsigned> m_masterPagesByPageSeqNum;
-  std::map<unsigned, std::vector<unsigned> > m_tableCellTextEndsByTextId;
-  std::map<unsigned, unsigned> m_stringOffsetsByTextId;
-  mutable std::vector<bool> m_calculationValuesSeen;
-  std::vector<unsigned> m_pageSeqNumsOrdered;
-  bool m_encodingHeuristic;
-  std::vector<unsigned char> m_allText;
-  mutable boost::optional<const char *> m_calculatedEncoding;
-  librevenge::RVNGPropertyList m_metaData;
 
   // helper functions
-  std::vector<int> getShapeAdjustValues(const ShapeInfo &info) const;
-  boost::optional<unsigned> getMasterPageSeqNum(unsigned pageSeqNum) const;
-  void setRectCoordProps(Coordinate, librevenge::RVNGPropertyList *) const;
-  boost::optional<std::vector<libmspub::TextParagraph> > getShapeText(const ShapeInfo &info) const;
   void setupShapeStructures(ShapeGroupElement &elt);
   void addBlackToPaletteIfNecessary();
   void assignShapesToPages();
-  void writePage(unsigned pageSeqNum) const;
-  void writePageShapes(unsigned pageSeqNum) const;
-  void writePageBackground(unsigned pageSeqNum) const;
-  void writeImage(double x, double y, double height, double width,
-                  ImgType type, const librevenge::RVNGBinaryData &blob,
-                  boost::optional<Color> oneBitColor) const;
-  bool pageIsMaster(unsigned pageSeqNum) const;
-
-  std::function<void(void)> paintShape(const ShapeInfo &info, const Coordinate &relativeTo, const VectorTransformation2D &foldedTransform, bool isGroup, const VectorTransformation2D &thisTransform) const;
-  double getCalculationValue(const ShapeInfo &info, unsigned index, bool recursiveEntry, const std::vector<int> &adjustValues) const;
-
-  librevenge::RVNGPropertyList getCharStyleProps(const CharacterStyle &, boost::optional<unsigned> defaultCharStyleIndex) const;
-  librevenge::RVNGPropertyList getParaStyleProps(const ParagraphStyle &, boost::optional<unsigned> defaultParaStyleIndex) const;
-  double getSpecialValue(const ShapeInfo &info, const CustomShape &shape, int arg, const std::vector<int> &adjustValues) const;
   void ponderStringEncoding(const std::vector<TextParagraph> &str);
-  const char *getCalculatedEncoding() const;
-public:
-  static librevenge::RVNGString getColorString(const Color &);
 };
 
 } // namespace libmspub
@@ -10,8 +10,14 @@
 #include <libmspub/libmspub.h>
 
 #include <memory>
+#include <utility>
+
+#include <boost/optional.hpp>
 
 #include "MSPUBCollector.h"
+#include "MSPUBDocumentContext.h"
+#include "MSPUBEmitter.h"
+#include "MSPUBParseCache.h"
 #include "MSPUBParser.h"
 #include "MSPUBParser2k.h"
 #include "MSPUBParser97.h"
@@ -20,59 +26,94 @@
 namespace libmspub
 {
 
-namespace
+class MSPUBDocumentImpl
 {
+public:
+  explicit MSPUBDocumentImpl(librevenge::RVNGInputStream *input)
+    : m_context(input), m_collector()
+  {
+  }
 
-enum MSPUBVersion
-{
-  MSPUB_UNKNOWN_VERSION = 0,
-  MSPUB_2K,
-  MSPUB_2K2
+  MSPUBDocumentContext m_context;
+  // the parsed document, kept for the following calls of parse()
+  std::unique_ptr<MSPUBCollector> m_collector;
 };
 
-MSPUBVersion getVersion(librevenge::RVNGInputStream *input)
+namespace
 {
-  try
-  {
-    if (!input->isStructured())
-      return MSPUB_UNKNOWN_VERSION;
-
-    std::unique_ptr<librevenge::RVNGInputStream> contentsStream(input->getSubStreamByName("Contents"));
-    if (!contentsStream)
-      return MSPUB_UNKNOWN_VERSION;
 
-    if (0xe8 != readU8(contentsStream.get()) || 0xac != readU8(contentsStream.get()))
-      return MSPUB_UNKNOWN_VERSION;
-
-    unsigned char magicVersionByte = readU8(contentsStream.get());
+bool isSupportedDocument(MSPUBDocumentContext &context)
+{
+  MSPUBVersion version = context.getVersion();
+  if (version == MSPUB_UNKNOWN_VERSION)
+    return false;
 
-    if (0x00 != readU8(contentsStream.get()))
-      return MSPUB_UNKNOWN_VERSION;
+  if (version == MSPUB_2K2)
+  {
+    if (!context.hasSubStream("Escher/EscherStm"))
+      return false;
+    if (!context.hasSubStream("Quill/QuillSub/CONTENTS"))
+      return false;
+  }
+  return true;
+}
 
-    MSPUBVersion version = MSPUB_UNKNOWN_VERSION;
-    switch (magicVersionByte)
-    {
-    case 0x2C:
-      version = MSPUB_2K2;
-      break;
-    case 0x22:
-      version =  MSPUB_2K;
-      break;
-    default:
-      break;
-    }
-    return version;
+bool runParser(MSPUBDocumentContext &context, MSPUBCollector &collector)
+{
+  context.getInput()->seek(0, librevenge::RVNG_SEEK_SET);
+  std::unique_ptr<MSPUBParser> parser;
+  switch (context.getVersion())
+  {
+  case MSPUB_2K:
+  {
+    if (!context.getSubStream("Quill/QuillSub/CONTENTS"))
+      parser.reset(new MSPUBParser97(&context, &collector));
+    else
+      parser.reset(new MSPUBParser2k(&context, &collector));
+    break;
   }
-  catch (...)
+  case MSPUB_2K2:
   {
-    return MSPUB_UNKNOWN_VERSION;
+    parser.reset(new MSPUBParser(&context, &collector));
+    break;
   }
-
+  default:
+    return false;
+  }
+  if (parser)
+  {
+    return parser->parse();
+  }
+  return false;
 }
 
-} // anonymous namespace
+std::unique_ptr<MSPUBCollector> parseDocument(MSPUBDocumentContext &context, const boost::optional<std::pair<unsigned, unsigned> > &pageRange = boost::none)
+{
+  const auto newCollector = [&pageRange]()
+  {
+    std::unique_ptr<MSPUBCollector> collector(new MSPUBCollector());
+    if (pageRange)
+      collector->setPageRange(pageRange->first, pageRange->second);
+    return collector;
+  };
 
+  MSPUBParseCache cache(context);
+  std::unique_ptr<MSPUBCollector> collector = newCollector();
+  if (!cache.load(*collector))
+  {
+    collector = newCollector();
+    if (!runParser(context, *collector))
+      return nullptr;
+    // the model of a page range is incomplete
+    if (!pageRange)
+      cache.store(*collector);
+  }
+  if (!collector->go())
+    return nullptr;
+  return collector;
+}
 
+} // anonymous namespace
 
 /**
 Analyzes the content of an input stream to see if it can be parsed
@@ -87,20 +128,8 @@ PUBAPI bool MSPUBDocument::isSupported(librevenge::RVNGInputStream *input)
 
   try
   {
-    MSPUBVersion version = getVersion(input);
-    if (version == MSPUB_UNKNOWN_VERSION)
-      return false;
-
-    if (version == MSPUB_2K2)
-    {
-      std::unique_ptr<librevenge::RVNGInputStream> escherStream(input->getSubStreamByName("Escher/EscherStm"));
-      if (!escherStream)
-        return false;
-      std::unique_ptr<librevenge::RVNGInputStream> quillStream(input->getSubStreamByName("Quill/QuillSub/CONTENTS"));
-      if (!quillStream)
-        return false;
-    }
-    return true;
+    MSPUBDocumentContext context(input);
+    return isSupportedDocument(context);
   }
   catch (...)
   {
@@ -123,33 +152,119 @@ PUBAPI bool MSPUBDocument::parse(librevenge::RVNGInputStream *input, librevenge:
 
   try
   {
-    MSPUBCollector collector(painter);
-    input->seek(0, librevenge::RVNG_SEEK_SET);
-    std::unique_ptr<MSPUBParser> parser;
-    switch (getVersion(input))
+    MSPUBDocumentContext context(input);
+    const std::unique_ptr<MSPUBCollector> collector = parseDocument(context);
+    return collector && MSPUBEmitter(collector->getModel()).emit(painter);
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+/**
+Parses a range of pages of the input stream content. Only the shapes and
+texts on these pages, and on the master pages they use, are read.
+\param input The input stream
+\param painter A MSPUBPainterInterface implementation
+\param firstPage The first page to emit, counting from 1; master pages are
+not counted
+\param lastPage The last page to emit
+\return A value that indicates whether the parsing was successful
+*/
+PUBAPI bool MSPUBDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *painter, const unsigned firstPage, const unsigned lastPage)
+{
+  if (!input || !painter || firstPage == 0 || lastPage < firstPage)
+    return false;
+
+  try
+  {
+    MSPUBDocumentContext context(input);
+    const std::unique_ptr<MSPUBCollector> collector = parseDocument(context, std::make_pair(firstPage, lastPage));
+    return collector && MSPUBEmitter(collector->getModel()).emit(painter);
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+/**
+Opens a document for repeated use. The format is detected once, and the
+substreams read for detection are kept for the following calls.
+\param input The input stream; it must outlive the returned document
+\return A new document, to be deleted by the caller, or null if the
+content of the input stream is not a supported Microsoft Publisher Document
+*/
+PUBAPI MSPUBDocument *MSPUBDocument::open(librevenge::RVNGInputStream *input)
+{
+  if (!input)
+    return nullptr;
+
+  try
+  {
+    std::unique_ptr<MSPUBDocumentImpl> impl(new MSPUBDocumentImpl(input));
+    if (!isSupportedDocument(impl->m_context))
+      return nullptr;
+    return new MSPUBDocument(impl.release());
+  }
+  catch (...)
+  {
+    return nullptr;
+  }
+}
+
+MSPUBDocument::MSPUBDocument(MSPUBDocumentImpl *const impl)
+  : m_impl(impl)
+{
+}
+
+PUBAPI MSPUBDocument::~MSPUBDocument()
+{
+  delete m_impl;
+}
+
+/**
+Returns the version of Microsoft Publisher that the document was saved by.
+*/
+PUBAPI MSPUBDocument::Version MSPUBDocument::getVersion() const
+{
+  try
+  {
+    switch (m_impl->m_context.getVersion())
     {
     case MSPUB_2K:
-    {
-      std::unique_ptr<librevenge::RVNGInputStream> quillStream(input->getSubStreamByName("Quill/QuillSub/CONTENTS"));
-      if (!quillStream)
-        parser.reset(new MSPUBParser97(input, &collector));
-      else
-        parser.reset(new MSPUBParser2k(input, &collector));
-      break;
-    }
+      return m_impl->m_context.hasSubStream("Quill/QuillSub/CONTENTS") ? VERSION_2000 : VERSION_97;
     case MSPUB_2K2:
-    {
-      parser.reset(new MSPUBParser(input, &collector));
-      break;
-    }
+      return VERSION_2002;
     default:
-      return false;
-    }
-    if (parser)
-    {
-      return parser->parse();
+      return VERSION_UNKNOWN;
     }
+  }
+  catch (...)
+  {
+    return VERSION_UNKNOWN;
+  }
+}
+
+/**
+Parses the document. It will make callbacks to the functions provided by a
+RVNGDrawingInterface class implementation when needed. It can be called
+repeatedly, e.g., to drive several generators; the document is only read
+by the first successful call.
+\param painter A MSPUBPainterInterface implementation
+\return A value that indicates whether the parsing was successful
+*/
+PUBAPI bool MSPUBDocument::parse(librevenge::RVNGDrawingInterface *painter)
+{
+  if (!painter)
     return false;
+
+  try
+  {
+    if (!m_impl->m_collector)
+      m_impl->m_collector = parseDocument(m_impl->m_context);
+    return m_impl->m_collector && MSPUBEmitter(m_impl->m_collector->getModel()).emit(painter);
   }
   catch (...)
   {
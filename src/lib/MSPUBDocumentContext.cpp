@@ -0,0 +1,98 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MSPUBDocumentContext.h"
+
+namespace libmspub
+{
+
+MSPUBDocumentContext::MSPUBDocumentContext(librevenge::RVNGInputStream *const input)
+  : m_input(input), m_length(), m_version(), m_subStreams()
+{
+}
+
+MSPUBDocumentContext::~MSPUBDocumentContext()
+{
+}
+
+unsigned long MSPUBDocumentContext::getLength()
+{
+  if (!m_length)
+    m_length = libmspub::getLength(m_input);
+  return m_length.get();
+}
+
+MSPUBVersion MSPUBDocumentContext::getVersion()
+{
+  if (!m_version)
+    m_version = detectVersion();
+  return m_version.get();
+}
+
+MSPUBMemoryStream *MSPUBDocumentContext::getSubStream(const char *const name)
+{
+  auto it = m_subStreams.find(name);
+  if (it == m_subStreams.end())
+  {
+    // a missing substream is cached too, as a null pointer
+    std::unique_ptr<MSPUBMemoryStream> subStream;
+    if (m_input->isStructured())
+      subStream = MSPUBMemoryStream::openSubStream(m_input, name);
+    it = m_subStreams.insert(std::make_pair(std::string(name), std::move(subStream))).first;
+  }
+  MSPUBMemoryStream *const subStream = it->second.get();
+  if (subStream)
+    subStream->seek(0, librevenge::RVNG_SEEK_SET);
+  return subStream;
+}
+
+bool MSPUBDocumentContext::hasSubStream(const char *const name)
+{
+  return bool(getSubStream(name));
+}
+
+MSPUBVersion MSPUBDocumentContext::detectVersion()
+{
+  try
+  {
+    MSPUBMemoryStream *const contentsStream = getSubStream("Contents");
+    if (!contentsStream)
+      return MSPUB_UNKNOWN_VERSION;
+
+    if (0xe8 != readU8(contentsStream) || 0xac != readU8(contentsStream))
+      return MSPUB_UNKNOWN_VERSION;
+
+    unsigned char magicVersionByte = readU8(contentsStream);
+
+    if (0x00 != readU8(contentsStream))
+      return MSPUB_UNKNOWN_VERSION;
+
+    MSPUBVersion version = MSPUB_UNKNOWN_VERSION;
+    switch (magicVersionByte)
+    {
+    case 0x2C:
+      version = MSPUB_2K2;
+      break;
+    case 0x22:
+      version =  MSPUB_2K;
+      break;
+    default:
+      break;
+    }
+    return version;
+  }
+  catch (...)
+  {
+    return MSPUB_UNKNOWN_VERSION;
+  }
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,70 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MSPUBDOCUMENTCONTEXT_H
+#define INCLUDED_MSPUBDOCUMENTCONTEXT_H
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include <librevenge/librevenge.h>
+
+#include "MSPUBMemoryStream.h"
+
+namespace libmspub
+{
+
+enum MSPUBVersion
+{
+  MSPUB_UNKNOWN_VERSION = 0,
+  MSPUB_2K,
+  MSPUB_2K2
+};
+
+/* Per-document state shared by format detection and the parsers: every
+ * substream is opened at most once, and copied only if its buffer cannot
+ * be borrowed, and the version is only detected once.
+ */
+class MSPUBDocumentContext
+{
+public:
+  explicit MSPUBDocumentContext(librevenge::RVNGInputStream *input);
+  ~MSPUBDocumentContext();
+
+  librevenge::RVNGInputStream *getInput() const
+  {
+    return m_input;
+  }
+  unsigned long getLength();
+  MSPUBVersion getVersion();
+
+  // Returns the substream rewound to its start, or null if it does not
+  // exist. The context keeps ownership.
+  MSPUBMemoryStream *getSubStream(const char *name);
+  bool hasSubStream(const char *name);
+
+private:
+  MSPUBDocumentContext(const MSPUBDocumentContext &);
+  MSPUBDocumentContext &operator=(const MSPUBDocumentContext &);
+
+  MSPUBVersion detectVersion();
+
+  librevenge::RVNGInputStream *const m_input;
+  boost::optional<unsigned long> m_length;
+  boost::optional<MSPUBVersion> m_version;
+  std::map<std::string, std::unique_ptr<MSPUBMemoryStream> > m_subStreams;
+};
+
+}
+
+#endif // INCLUDED_MSPUBDOCUMENTCONTEXT_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
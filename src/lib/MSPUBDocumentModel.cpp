@@ -0,0 +1,153 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MSPUBDocumentModel.h"
+
+#include <unicode/ucsdet.h>
+
+#include "ShapeGroupElement.h"
+#include "libmspub_utils.h"
+
+namespace libmspub
+{
+
+MSPUBDocumentModel::MSPUBDocumentModel()
+  : m_width(0), m_height(0),
+    m_widthSet(false), m_heightSet(false),
+    m_textStringsById(), m_pagesBySeqNum(),
+    m_images(), m_borderImages(),
+    m_textColors(), m_fonts(),
+    m_defaultCharStyles(), m_defaultParaStyles(), m_shapeTypesBySeqNum(),
+    m_paletteColors(), m_shapeSeqNumsOrdered(),
+    m_pageSeqNumsByShapeSeqNum(), m_bgShapeSeqNumsByPageSeqNum(),
+    m_skipIfNotBgSeqNums(),
+    m_topLevelShapes(),
+    m_groupsBySeqNum(), m_embeddedFonts(),
+    m_shapeInfosBySeqNum(), m_masterPages(),
+    m_shapesWithCoordinatesRotated90(),
+    m_masterPagesByPageSeqNum(),
+    m_tableCellTextEndsByTextId(), m_stringOffsetsByTextId(),
+    m_pageSeqNumsOrdered(),
+    m_encodingHeuristic(false), m_allText(),
+    m_metaData(),
+    m_pageRange(), m_calculatedEncoding()
+{
+}
+
+MSPUBDocumentModel::~MSPUBDocumentModel()
+{
+}
+
+boost::optional<unsigned> MSPUBDocumentModel::getMasterPageSeqNum(unsigned pageSeqNum) const
+{
+  boost::optional<unsigned> toReturn;
+  const unsigned *ptr_masterSeqNum = getIfExists_const(m_masterPagesByPageSeqNum, pageSeqNum);
+  if (ptr_masterSeqNum && m_masterPages.find(*ptr_masterSeqNum) != m_masterPages.end())
+  {
+    return *ptr_masterSeqNum;
+  }
+  return toReturn;
+}
+
+bool MSPUBDocumentModel::pageIsMaster(unsigned pageSeqNum) const
+{
+  return m_masterPages.find(pageSeqNum) != m_masterPages.end();
+}
+
+std::vector<unsigned> MSPUBDocumentModel::getOrderedPageSeqNums() const
+{
+  std::vector<unsigned> pageSeqNums;
+  if (m_pageSeqNumsOrdered.empty())
+  {
+    for (SeqNumMap<PageInfo>::const_iterator i = m_pagesBySeqNum.begin();
+         i != m_pagesBySeqNum.end(); ++i)
+    {
+      if (!pageIsMaster(i->first))
+      {
+        pageSeqNums.push_back(i->first);
+      }
+    }
+  }
+  else
+  {
+    for (unsigned int i : m_pageSeqNumsOrdered)
+    {
+      if (m_pagesBySeqNum.find(i) != m_pagesBySeqNum.end() && !pageIsMaster(i))
+      {
+        pageSeqNums.push_back(i);
+      }
+    }
+  }
+  return pageSeqNums;
+}
+
+bool MSPUBDocumentModel::isPageSelected(const unsigned pageIndex) const
+{
+  return !m_pageRange || (pageIndex + 1 >= m_pageRange->first && pageIndex + 1 <= m_pageRange->second);
+}
+
+const char *MSPUBDocumentModel::calculateEncoding() const
+{
+  // modern versions are somewhat sane and use Unicode
+  if (! m_encodingHeuristic)
+  {
+    return "UTF-16LE";
+  }
+  // for older versions of PUB, see if we can get ICU to tell us the encoding.
+  UErrorCode status = U_ZERO_ERROR;
+  UCharsetDetector *ucd = nullptr;
+  const UCharsetMatch **matches = nullptr;
+  const UCharsetMatch *ucm = nullptr;
+  ucd = ucsdet_open(&status);
+  int matchesFound = -1;
+  const char *name = nullptr;
+  const char *windowsName = nullptr;
+  if (m_allText.empty())
+  {
+    goto csd_fail;
+  }
+  if (U_FAILURE(status))
+  {
+    goto csd_fail;
+  }
+  // don't worry, the below call doesn't require a null-terminated string.
+  ucsdet_setText(ucd, (const char *)m_allText.data(), m_allText.size(), &status);
+  if (U_FAILURE(status))
+  {
+    goto csd_fail;
+  }
+  matches = ucsdet_detectAll(ucd, &matchesFound, &status);
+  if (U_FAILURE(status))
+  {
+    goto csd_fail;
+  }
+  //find best fit that is an actual Windows encoding
+  for (int i = 0; i < matchesFound; ++i)
+  {
+    ucm = matches[i];
+    name = ucsdet_getName(ucm, &status);
+    if (U_FAILURE(status))
+    {
+      goto csd_fail;
+    }
+    windowsName = windowsCharsetNameByOriginalCharset(name);
+    if (windowsName)
+    {
+      ucsdet_close(ucd);
+      return windowsName;
+    }
+  }
+csd_fail:
+  ucsdet_close(ucd);
+  return "windows-1252"; // Pretty likely to give garbage text, but it's the best we can do.
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,102 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MSPUBDOCUMENTMODEL_H
+#define INCLUDED_MSPUBDOCUMENTMODEL_H
+
+#include <list>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <librevenge/librevenge.h>
+
+#include "BorderArtInfo.h"
+#include "ColorReference.h"
+#include "EmbeddedFontInfo.h"
+#include "ImgInfo.h"
+#include "MSPUBTypes.h"
+#include "SeqNumMap.h"
+#include "ShapeInfo.h"
+#include "ShapeType.h"
+
+namespace libmspub
+{
+
+class ShapeGroupElement;
+
+/* Everything the parsers found in a document: pages, shapes, text, images
+ * and styles. MSPUBCollector builds it through its setters and
+ * MSPUBEmitter emits it to a painter; once built, it can be emitted any
+ * number of times.
+ */
+struct MSPUBDocumentModel
+{
+  struct PageInfo
+  {
+    std::vector<std::shared_ptr<ShapeGroupElement>> m_shapeGroupsOrdered;
+    PageInfo() : m_shapeGroupsOrdered() { }
+  };
+
+  MSPUBDocumentModel();
+  ~MSPUBDocumentModel();
+
+  double m_width, m_height;
+  bool m_widthSet, m_heightSet;
+  SeqNumMap<std::vector<TextParagraph>> m_textStringsById;
+  SeqNumMap<PageInfo> m_pagesBySeqNum;
+  std::vector<ImgInfo> m_images;
+  std::vector<BorderArtInfo> m_borderImages;
+  std::vector<ColorReference> m_textColors;
+  std::vector<std::vector<unsigned char> > m_fonts;
+  std::vector<CharacterStyle> m_defaultCharStyles;
+  std::vector<ParagraphStyle> m_defaultParaStyles;
+  SeqNumMap<ShapeType> m_shapeTypesBySeqNum;
+  std::vector<Color> m_paletteColors;
+  std::vector<unsigned> m_shapeSeqNumsOrdered;
+  SeqNumMap<unsigned> m_pageSeqNumsByShapeSeqNum;
+  SeqNumMap<unsigned> m_bgShapeSeqNumsByPageSeqNum;
+  std::set<unsigned> m_skipIfNotBgSeqNums;
+  std::vector<std::shared_ptr<ShapeGroupElement>> m_topLevelShapes;
+  SeqNumMap<std::shared_ptr<ShapeGroupElement>> m_groupsBySeqNum;
+  std::list<EmbeddedFontInfo> m_embeddedFonts;
+  SeqNumMap<ShapeInfo> m_shapeInfosBySeqNum;
+  std::set<unsigned> m_masterPages;
+  std::set<unsigned> m_shapesWithCoordinatesRotated90;
+  SeqNumMap<unsigned> m_masterPagesByPageSeqNum;
+  SeqNumMap<std::vector<unsigned>> m_tableCellTextEndsByTextId;
+  SeqNumMap<unsigned> m_stringOffsetsByTextId;
+  std::vector<unsigned> m_pageSeqNumsOrdered;
+  bool m_encodingHeuristic;
+  std::vector<unsigned char> m_allText;
+  librevenge::RVNGPropertyList m_metaData;
+  // the pages to emit, counted from 1 in the order they are emitted
+  boost::optional<std::pair<unsigned, unsigned> > m_pageRange;
+  // set once all the text is known
+  boost::optional<const char *> m_calculatedEncoding;
+
+  boost::optional<unsigned> getMasterPageSeqNum(unsigned pageSeqNum) const;
+  bool pageIsMaster(unsigned pageSeqNum) const;
+  // the seqnums of the pages that are not master pages, in emission order
+  std::vector<unsigned> getOrderedPageSeqNums() const;
+  bool isPageSelected(unsigned pageIndex) const;
+  const char *calculateEncoding() const;
+
+private:
+  MSPUBDocumentModel(const MSPUBDocumentModel &);
+  MSPUBDocumentModel &operator=(const MSPUBDocumentModel &);
+};
+
+}
+
+#endif // INCLUDED_MSPUBDOCUMENTMODEL_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
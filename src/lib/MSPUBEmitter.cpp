@@ -0,0 +1,1302 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MSPUBEmitter.h"
+
+#include <cassert>
+#include <functional>
+#include <math.h>
+#include <memory>
+
+#include <boost/multi_array.hpp>
+
+#include <unicode/uloc.h>
+
+#include "Arrow.h"
+#include "Coordinate.h"
+#include "Dash.h"
+#include "Fill.h"
+#include "Line.h"
+#include "Margins.h"
+#include "MSPUBConstants.h"
+#include "MSPUBTypes.h"
+#include "PolygonUtils.h"
+#include "Shadow.h"
+#include "ShapeGroupElement.h"
+#include "ShapeGuides.h"
+#include "TableInfo.h"
+#include "VectorTransformation2D.h"
+#include "libmspub_utils.h"
+
+namespace libmspub
+{
+
+using namespace std::placeholders;
+
+namespace
+{
+
+static void separateTabsAndInsertText(librevenge::RVNGDrawingInterface *iface, const librevenge::RVNGString &text)
+{
+  if (!iface || text.empty())
+    return;
+  librevenge::RVNGString tmpText;
+  librevenge::RVNGString::Iter i(text);
+  for (i.rewind(); i.next();)
+  {
+    if (*(i()) == '\t')
+    {
+      if (!tmpText.empty())
+      {
+        if (iface)
+          iface->insertText(tmpText);
+        tmpText.clear();
+      }
+
+      if (iface)
+        iface->insertTab();
+    }
+    else if (*(i()) == '\n')
+    {
+      if (!tmpText.empty())
+      {
+        if (iface)
+          iface->insertText(tmpText);
+        tmpText.clear();
+      }
+
+      if (iface)
+        iface->insertLineBreak();
+    }
+    else
+    {
+      tmpText.append(i());
+    }
+  }
+  if (iface && !tmpText.empty())
+    iface->insertText(tmpText);
+}
+
+static void separateSpacesAndInsertText(librevenge::RVNGDrawingInterface *iface, const librevenge::RVNGString &text)
+{
+  if (!iface)
+    return;
+  if (text.empty())
+  {
+    iface->insertText(text);
+    return;
+  }
+  librevenge::RVNGString tmpText;
+  int numConsecutiveSpaces = 0;
+  librevenge::RVNGString::Iter i(text);
+  for (i.rewind(); i.next();)
+  {
+    if (*(i()) == ' ')
+      numConsecutiveSpaces++;
+    else
+      numConsecutiveSpaces = 0;
+
+    if (numConsecutiveSpaces > 1)
+    {
+      if (!tmpText.empty())
+      {
+        separateTabsAndInsertText(iface, tmpText);
+        tmpText.clear();
+      }
+
+      if (iface)
+        iface->insertSpace();
+    }
+    else
+    {
+      tmpText.append(i());
+    }
+  }
+  separateTabsAndInsertText(iface, tmpText);
+}
+
+struct TableLayoutCell
+{
+  TableLayoutCell()
+    : m_cell(0)
+    , m_rowSpan(0)
+    , m_colSpan(0)
+  {
+  }
+
+  unsigned m_cell;
+  unsigned m_rowSpan;
+  unsigned m_colSpan;
+};
+
+bool isCovered(const TableLayoutCell &cell)
+{
+  assert((cell.m_rowSpan == 0) == (cell.m_colSpan == 0));
+  return (cell.m_rowSpan == 0) && (cell.m_colSpan == 0);
+}
+
+typedef boost::multi_array<TableLayoutCell, 2> TableLayout;
+
+void createTableLayout(const std::vector<CellInfo> &cells, TableLayout &tableLayout)
+{
+  for (auto it = cells.begin(); it != cells.end(); ++it)
+  {
+    if ((it->m_endRow >= tableLayout.shape()[0]) || (it->m_endColumn >= tableLayout.shape()[1]))
+    {
+      MSPUB_DEBUG_MSG((
+                        "cell %u (rows %u to %u, columns %u to %u) overflows the table, ignoring\n",
+                        unsigned(int(it - cells.begin())),
+                        it->m_startRow, it->m_endRow,
+                        it->m_startColumn, it->m_endColumn
+                      ));
+      continue;
+    }
+    if (it->m_startRow > it->m_endRow)
+    {
+      MSPUB_DEBUG_MSG((
+                        "cell %u (rows %u to %u) has got negative row span, ignoring\n",
+                        unsigned(int(it - cells.begin())),
+                        it->m_startRow, it->m_endRow
+                      ));
+      continue;
+    }
+    if (it->m_startColumn > it->m_endColumn)
+    {
+      MSPUB_DEBUG_MSG((
+                        "cell %u (columns %u to %u) has got negative column span, ignoring\n",
+                        unsigned(int(it - cells.begin())),
+                        it->m_startColumn, it->m_endColumn
+                      ));
+      continue;
+    }
+
+    const unsigned rowSpan = it->m_endRow - it->m_startRow + 1;
+    const unsigned colSpan = it->m_endColumn - it->m_startColumn + 1;
+
+    if ((rowSpan == 0) != (colSpan == 0))
+    {
+      MSPUB_DEBUG_MSG((
+                        "cell %u (rows %u to %u, columns %u to %u) has got 0 span in one dimension, ignoring\n",
+                        unsigned(int(it - cells.begin())),
+                        it->m_startRow, it->m_endRow,
+                        it->m_startColumn, it->m_endColumn
+                      ));
+      continue;
+    }
+
+    TableLayoutCell &layoutCell = tableLayout[it->m_startRow][it->m_startColumn];
+    layoutCell.m_cell = unsigned(int(it - cells.begin()));
+    layoutCell.m_rowSpan = rowSpan;
+    layoutCell.m_colSpan = colSpan;
+  }
+}
+
+typedef std::vector<std::pair<unsigned, unsigned> > ParagraphToCellMap_t;
+typedef std::vector<librevenge::RVNGString> SpanTexts_t;
+typedef std::vector<SpanTexts_t> ParagraphTexts_t;
+
+void mapTableTextToCells(
+  const std::vector<TextParagraph> &text,
+  const std::vector<unsigned> &tableCellTextEnds,
+  const char *const encoding,
+  ParagraphToCellMap_t &paraToCellMap,
+  ParagraphTexts_t &paraTexts
+)
+{
+  assert(paraToCellMap.empty());
+  assert(paraTexts.empty());
+
+  paraToCellMap.reserve(tableCellTextEnds.size());
+  paraTexts.reserve(tableCellTextEnds.size());
+
+  unsigned firstPara = 0;
+  unsigned offset = 1;
+  for (unsigned para = 0; para != text.size() && paraToCellMap.size() < tableCellTextEnds.size(); ++para)
+  {
+    paraTexts.push_back(SpanTexts_t());
+    paraTexts.back().reserve(text[para].spans.size());
+
+    for (unsigned i_spans = 0; i_spans != text[para].spans.size(); ++i_spans)
+    {
+      librevenge::RVNGString textString;
+      appendCharacters(textString, text[para].spans[i_spans].chars, encoding);
+      offset += textString.len();
+      // TODO: why do we not drop these during parse already?
+      if ((i_spans == text[para].spans.size() - 1) && (textString == "\r"))
+        continue;
+      paraTexts.back().push_back(textString);
+    }
+
+    assert(paraTexts.back().size() <= text[para].spans.size());
+
+    if (offset >= tableCellTextEnds[paraToCellMap.size()])
+    {
+      if (offset > tableCellTextEnds[paraToCellMap.size()])
+      {
+        MSPUB_DEBUG_MSG(("text of cell %u ends in the middle of a paragraph!\n", unsigned(paraToCellMap.size())));
+      }
+
+      paraToCellMap.push_back(std::make_pair(firstPara, para));
+      firstPara = para + 1;
+    }
+  }
+
+  assert(paraTexts.size() == text.size());
+  assert(paraToCellMap.size() <= tableCellTextEnds.size());
+}
+
+void fillUnderline(librevenge::RVNGPropertyList &props, const Underline underline)
+{
+  switch (underline)
+  {
+  case Underline::None:
+    return;
+  case Underline::Single:
+  case Underline::WordsOnly:
+  case Underline::Double:
+  case Underline::Thick:
+    props.insert("style:text-underline-style", "solid");
+    break;
+  case Underline::Dotted:
+  case Underline::ThickDot:
+    props.insert("style:text-underline-style", "dotted");
+    break;
+  case Underline::Dash:
+  case Underline::ThickDash:
+    props.insert("style:text-underline-style", "dash");
+    break;
+  case Underline::DotDash:
+  case Underline::ThickDotDash:
+    props.insert("style:text-underline-style", "dot-dash");
+    break;
+  case Underline::DotDotDash:
+  case Underline::ThickDotDotDash:
+    props.insert("style:text-underline-style", "dot-dot-dash");
+    break;
+  case Underline::Wave:
+  case Underline::ThickWave:
+  case Underline::DoubleWave:
+    props.insert("style:text-underline-style", "wave");
+    break;
+  case Underline::LongDash:
+  case Underline::ThickLongDash:
+    props.insert("style:text-underline-style", "long-dash");
+    break;
+  }
+
+  switch (underline)
+  {
+  case Underline::Double:
+  case Underline::DoubleWave:
+    props.insert("style:text-underline-type", "double");
+    break;
+  default:
+    props.insert("style:text-underline-type", "single");
+    break;
+  }
+
+  switch (underline)
+  {
+  case Underline::Thick:
+  case Underline::ThickWave:
+  case Underline::ThickDot:
+  case Underline::ThickDash:
+  case Underline::ThickDotDash:
+  case Underline::ThickDotDotDash:
+    props.insert("style:text-underline-width", "bold");
+    break;
+  default:
+    props.insert("style:text-underline-width", "auto");
+    break;
+  }
+
+  switch (underline)
+  {
+  case Underline::WordsOnly:
+    props.insert("style:text-underline-mode", "skip-white-space");
+    break;
+  default:
+    props.insert("style:text-underline-mode", "continuous");
+    break;
+  }
+}
+
+void fillLocale(librevenge::RVNGPropertyList &props, const unsigned lcid)
+{
+  char locale[ULOC_FULLNAME_CAPACITY];
+  UErrorCode status = U_ZERO_ERROR;
+  uloc_getLocaleForLCID(lcid, locale, ULOC_FULLNAME_CAPACITY, &status);
+  if (!U_SUCCESS(status))
+    return;
+  char component[ULOC_FULLNAME_CAPACITY];
+  int32_t len = uloc_getLanguage(locale, component, ULOC_FULLNAME_CAPACITY, &status);
+  if (U_SUCCESS(status) && len > 0)
+    props.insert("fo:language", component);
+  len = uloc_getCountry(locale, component, ULOC_FULLNAME_CAPACITY, &status);
+  if (U_SUCCESS(status) && len > 0)
+    props.insert("fo:country", component);
+  len = uloc_getScript(locale, component, ULOC_FULLNAME_CAPACITY, &status);
+  if (U_SUCCESS(status) && len > 0)
+    props.insert("fo:script", component);
+}
+
+} // anonymous namespace
+
+MSPUBEmitter::MSPUBEmitter(const MSPUBDocumentModel &model)
+  : m_model(model),
+    m_encoding(model.m_calculatedEncoding ? model.m_calculatedEncoding.get() : model.calculateEncoding())
+{
+}
+
+void MSPUBEmitter::setRectCoordProps(Coordinate coord, librevenge::RVNGPropertyList *props) const
+{
+  props->insert("svg:x", coord.getXIn(m_model.m_width));
+  props->insert("svg:y", coord.getYIn(m_model.m_height));
+  props->insert("svg:width", coord.getWidthIn());
+  props->insert("svg:height", coord.getHeightIn());
+}
+
+Coordinate getFudgedCoordinates(Coordinate coord, const std::vector<Line> &lines, bool makeBigger, BorderPosition borderPosition)
+{
+  Coordinate fudged = coord;
+  unsigned topFudge = 0;
+  unsigned rightFudge = 0;
+  unsigned bottomFudge = 0;
+  unsigned leftFudge = 0;
+  switch (borderPosition)
+  {
+  case HALF_INSIDE_SHAPE:
+    topFudge = (!lines.empty()) ? lines[0].m_widthInEmu / 2 : 0;
+    rightFudge = (lines.size() > 1) ? lines[1].m_widthInEmu / 2 : 0;
+    bottomFudge = (lines.size() > 2) ? lines[2].m_widthInEmu / 2 : 0;
+    leftFudge = (lines.size() > 3) ? lines[3].m_widthInEmu / 2 : 0;
+    break;
+  case OUTSIDE_SHAPE:
+    topFudge = (!lines.empty()) ? lines[0].m_widthInEmu : 0;
+    rightFudge = (lines.size() > 1) ? lines[1].m_widthInEmu : 0;
+    bottomFudge = (lines.size() > 2) ? lines[2].m_widthInEmu : 0;
+    leftFudge = (lines.size() > 3) ? lines[3].m_widthInEmu : 0;
+    break;
+  case INSIDE_SHAPE:
+  default:
+    break;
+  }
+  if (makeBigger)
+  {
+    fudged.m_xs -= leftFudge;
+    fudged.m_xe += rightFudge;
+    fudged.m_ys -= topFudge;
+    fudged.m_ye += bottomFudge;
+  }
+  else
+  {
+    if (int64_t(fudged.m_xe) - fudged.m_xs > leftFudge)
+      fudged.m_xs += leftFudge;
+    if (int64_t(fudged.m_xe) - fudged.m_xs > rightFudge)
+      fudged.m_xe -= rightFudge;
+    if (int64_t(fudged.m_ye) - fudged.m_ys > topFudge)
+      fudged.m_ys += topFudge;
+    if (int64_t(fudged.m_ye) - fudged.m_ys > bottomFudge)
+      fudged.m_ye -= bottomFudge;
+  }
+  return fudged;
+}
+
+void no_op()
+{
+}
+
+void endShapeGroup(librevenge::RVNGDrawingInterface *painter)
+{
+  painter->endLayer();
+}
+
+const std::vector<TextParagraph> *MSPUBEmitter::getShapeText(const ShapeInfo &info) const
+{
+  if (bool(info.m_textId))
+  {
+    return getIfExists_const(m_model.m_textStringsById, info.m_textId.get());
+  }
+  return nullptr;
+}
+
+std::function<void(void)> MSPUBEmitter::paintShape(librevenge::RVNGDrawingInterface *const painter, const ShapeInfo &info, const Coordinate &/* relativeTo*/, const VectorTransformation2D &foldedTransform, bool isGroup, const VectorTransformation2D &thisTransform) const
+{
+  // go() resolves the geometry of every shape it hands to a ShapeGroupElement
+  assert(info.m_geometryResolved);
+  const std::vector<int> &adjustValues = info.getAdjustValues();
+  if (isGroup)
+  {
+    painter->startLayer(librevenge::RVNGPropertyList());
+    return std::bind(&endShapeGroup, painter);
+  }
+  librevenge::RVNGPropertyList graphicsProps;
+  if (info.m_fill)
+  {
+    info.m_fill->getProperties(&graphicsProps, m_model);
+  }
+  bool hasStroke = false;
+  bool hasBorderArt = false;
+  const ShapeExtraInfo &extra = info.getExtra();
+  boost::optional<unsigned> maybeBorderImg = extra.m_borderImgIndex;
+  if (bool(maybeBorderImg) && !info.m_lines.empty())
+  {
+    hasStroke = true;
+    hasBorderArt = true;
+  }
+  else
+  {
+    for (const auto &line : info.m_lines)
+    {
+      hasStroke = hasStroke || line.m_lineExists;
+      if (hasStroke)
+      {
+        break;
+      }
+    }
+  }
+  librevenge::RVNGString fill = graphicsProps["draw:fill"] ? graphicsProps["draw:fill"]->getStr() : "none";
+  bool hasFill = fill != "none";
+  const std::vector<TextParagraph> *const maybeText = getShapeText(info);
+  auto hasText = bool(maybeText);
+  const auto isTable = bool(extra.m_tableInfo);
+  bool makeLayer = hasBorderArt ||
+                   (hasStroke && hasFill) || (hasStroke && hasText) || (hasFill && hasText);
+  if (makeLayer)
+  {
+    if (extra.m_clipPath.size() > 0)
+    {
+      const Coordinate coord = info.m_coordinates.get_value_or(Coordinate());
+      double x, y, height, width;
+      x = coord.getXIn(m_model.m_width);
+      y = coord.getYIn(m_model.m_height);
+      height = coord.getHeightIn();
+      width = coord.getWidthIn();
+      painter->startLayer(calcClipPath(extra.m_clipPath, x, y, height, width, foldedTransform, info.getCustomShape()));
+    }
+    else
+      painter->startLayer(librevenge::RVNGPropertyList());
+  }
+  graphicsProps.insert("draw:stroke", "none");
+  const Coordinate coord = info.m_coordinates.get_value_or(Coordinate());
+  BorderPosition borderPosition =
+    hasBorderArt ? INSIDE_SHAPE : extra.m_borderPosition.get_value_or(HALF_INSIDE_SHAPE);
+  ShapeType type;
+  if (bool(extra.m_cropType))
+  {
+    type = extra.m_cropType.get();
+  }
+  else
+  {
+    type = info.m_type.get_value_or(RECTANGLE);
+  }
+  // all the guides are evaluated once, before the vertices that use them
+  const std::shared_ptr<const CustomShape> &customShape = info.getCustomShape();
+  std::vector<double> guideValues;
+  if (info.getGuides())
+  {
+    const double aspectRatio = coord.getHeightIn() != 0 ? double(coord.getWidthIn()) / coord.getHeightIn() : 0;
+    info.getGuides()->evaluate(adjustValues, aspectRatio, guideValues);
+  }
+  const std::function<double(unsigned)> calculator = [&guideValues](unsigned index)
+  {
+    return index < guideValues.size() ? guideValues[index] : 0;
+  };
+
+  if (hasFill)
+  {
+    double x, y, height, width;
+    x = coord.getXIn(m_model.m_width);
+    y = coord.getYIn(m_model.m_height);
+    height = coord.getHeightIn();
+    width = coord.getWidthIn();
+    if (hasBorderArt)
+    {
+      double borderImgWidth =
+        static_cast<double>(info.m_lines[0].m_widthInEmu) / EMUS_IN_INCH;
+      if (height > 2 * borderImgWidth && width >= 2 * borderImgWidth)
+      {
+        x += borderImgWidth;
+        y += borderImgWidth;
+        height -= 2 * borderImgWidth;
+        width -= 2 * borderImgWidth;
+      }
+    }
+    if (bool(extra.m_pictureRecolor))
+    {
+      Color obc = extra.m_pictureRecolor.get().getFinalColor(m_model.m_paletteColors);
+      graphicsProps.insert("draw:color-mode", "greyscale");
+      graphicsProps.insert("draw:red",
+                           static_cast<double>(obc.r) / 255.0, librevenge::RVNG_PERCENT);
+      graphicsProps.insert("draw:blue",
+                           static_cast<double>(obc.b) / 255.0, librevenge::RVNG_PERCENT);
+      graphicsProps.insert("draw:green",
+                           static_cast<double>(obc.g) / 255.0, librevenge::RVNG_PERCENT);
+    }
+    if (bool(extra.m_pictureBrightness))
+      graphicsProps.insert("draw:luminance", static_cast<double>(extra.m_pictureBrightness.get() + 32768.0) / 65536.0, librevenge::RVNG_PERCENT);
+    bool shadowPropsInserted = false;
+    if (bool(extra.m_shadow))
+    {
+      const Shadow &s = extra.m_shadow.get();
+      if (!needsEmulation(s))
+      {
+        shadowPropsInserted = true;
+        graphicsProps.insert("draw:shadow", "visible");
+        graphicsProps.insert("draw:shadow-offset-x", static_cast<double>(s.m_offsetXInEmu) / EMUS_IN_INCH);
+        graphicsProps.insert("draw:shadow-offset-y", static_cast<double>(s.m_offsetYInEmu) / EMUS_IN_INCH);
+        graphicsProps.insert("draw:shadow-color", getColorString(s.m_color.getFinalColor(m_model.m_paletteColors)));
+        graphicsProps.insert("draw:shadow-opacity", s.m_opacity, librevenge::RVNG_PERCENT);
+      }
+      // TODO: Emulate shadows that don't conform
+      // to LibreOffice's range of possible shadows.
+    }
+    painter->setStyle(graphicsProps);
+
+    writeCustomShape(type, graphicsProps, painter, x, y, height, width,
+                     true, foldedTransform,
+                     std::vector<Line>(), calculator, m_model.m_paletteColors, customShape);
+    if (bool(extra.m_pictureRecolor))
+    {
+      graphicsProps.remove("draw:color-mode");
+      graphicsProps.remove("draw:red");
+      graphicsProps.remove("draw:blue");
+      graphicsProps.remove("draw:green");
+    }
+    if (bool(extra.m_pictureBrightness))
+      graphicsProps.remove("draw:luminance");
+    if (shadowPropsInserted)
+    {
+      graphicsProps.remove("draw:shadow");
+      graphicsProps.remove("draw:shadow-offset-x");
+      graphicsProps.remove("draw:shadow-offset-y");
+      graphicsProps.remove("draw:shadow-color");
+      graphicsProps.remove("draw:shadow-opacity");
+    }
+  }
+  const std::vector<Line> &lines = info.m_lines;
+  if (hasStroke)
+  {
+    if (hasBorderArt && lines[0].m_widthInEmu > 0)
+    {
+      bool stretch = extra.m_stretchBorderArt;
+      double x = coord.getXIn(m_model.m_width);
+      double y = coord.getYIn(m_model.m_height);
+      double height = coord.getHeightIn();
+      double width = coord.getWidthIn();
+      double borderImgWidth =
+        static_cast<double>(info.m_lines[0].m_widthInEmu) / EMUS_IN_INCH;
+      auto numImagesHoriz = static_cast<unsigned>(width / borderImgWidth);
+      auto numImagesVert = static_cast<unsigned>(height / borderImgWidth);
+      double borderVertTotalPadding = height - numImagesVert * borderImgWidth;
+      double borderHorizTotalPadding = width - numImagesHoriz * borderImgWidth;
+      if (numImagesHoriz >= 2 && numImagesVert >= 2)
+      {
+        auto numStretchedImagesVert = static_cast<unsigned>(0.5 + (height - 2 * borderImgWidth) / borderImgWidth);
+        auto numStretchedImagesHoriz = static_cast<unsigned>(0.5 + (width - 2 * borderImgWidth) / borderImgWidth);
+        double stretchedImgHeight = stretch ?
+                                    (height - 2 * borderImgWidth) / numStretchedImagesVert :
+                                    borderImgWidth;
+        double stretchedImgWidth = stretch ?
+                                   (width - 2 * borderImgWidth) / numStretchedImagesHoriz :
+                                   borderImgWidth;
+        if (stretch)
+        {
+          numImagesVert = 2 + numStretchedImagesVert;
+          numImagesHoriz = 2 + numStretchedImagesHoriz;
+        }
+        double borderVertPadding = borderVertTotalPadding / (numImagesVert - 1);
+        double borderHorizPadding = borderHorizTotalPadding / (numImagesHoriz - 1);
+        if (maybeBorderImg.get() < m_model.m_borderImages.size())
+        {
+          const BorderArtInfo &ba = m_model.m_borderImages[maybeBorderImg.get()];
+          if (!ba.m_offsets.empty())
+          {
+            librevenge::RVNGPropertyList baProps;
+            baProps.insert("draw:stroke", "none");
+            baProps.insert("draw:fill", "solid");
+            baProps.insert("draw:fill-color", "#ffffff");
+            painter->setStyle(baProps);
+            librevenge::RVNGPropertyList topRectProps;
+            topRectProps.insert("svg:x", x);
+            topRectProps.insert("svg:y", y);
+            topRectProps.insert("svg:height", borderImgWidth);
+            topRectProps.insert("svg:width", width);
+            painter->drawRectangle(topRectProps);
+            librevenge::RVNGPropertyList rightRectProps;
+            rightRectProps.insert("svg:x", x + width - borderImgWidth);
+            rightRectProps.insert("svg:y", y);
+            rightRectProps.insert("svg:height", height);
+            rightRectProps.insert("svg:width", borderImgWidth);
+            painter->drawRectangle(rightRectProps);
+            librevenge::RVNGPropertyList botRectProps;
+            botRectProps.insert("svg:x", x);
+            botRectProps.insert("svg:y", y + height - borderImgWidth);
+            botRectProps.insert("svg:height", borderImgWidth);
+            botRectProps.insert("svg:width", width);
+            painter->drawRectangle(botRectProps);
+            librevenge::RVNGPropertyList leftRectProps;
+            leftRectProps.insert("svg:x", x);
+            leftRectProps.insert("svg:y", y);
+            leftRectProps.insert("svg:height", height);
+            leftRectProps.insert("svg:width", borderImgWidth);
+            painter->drawRectangle(leftRectProps);
+            auto iOffset = ba.m_offsets.begin();
+            boost::optional<Color> oneBitColor;
+            if (bool(extra.m_lineBackColor))
+            {
+              oneBitColor = extra.m_lineBackColor.get().getFinalColor(m_model.m_paletteColors);
+            }
+            // top left
+            unsigned iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                                    ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              writeImage(painter, x, y, borderImgWidth, borderImgWidth,
+                         bi.m_type, bi.m_imgBlob, oneBitColor);
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // top
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              for (unsigned iTop = 1; iTop < numImagesHoriz - 1; ++iTop)
+              {
+                double imgX = stretch ?
+                              x + borderImgWidth + (iTop - 1) * stretchedImgWidth :
+                              x + iTop * (borderImgWidth + borderHorizPadding);
+                writeImage(painter, imgX, y,
+                           borderImgWidth, stretchedImgWidth,
+                           bi.m_type, bi.m_imgBlob, oneBitColor);
+              }
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // top right
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              writeImage(painter, x + width - borderImgWidth, y,
+                         borderImgWidth, borderImgWidth,
+                         bi.m_type, bi.m_imgBlob, oneBitColor);
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // right
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              for (unsigned iRight = 1; iRight < numImagesVert - 1; ++iRight)
+              {
+                double imgY = stretch ?
+                              y + borderImgWidth + (iRight - 1) * stretchedImgHeight :
+                              y + iRight * (borderImgWidth + borderVertPadding);
+                writeImage(painter, x + width - borderImgWidth,
+                           imgY,
+                           stretchedImgHeight, borderImgWidth,
+                           bi.m_type, bi.m_imgBlob, oneBitColor);
+              }
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // bottom right
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              writeImage(painter, x + width - borderImgWidth,
+                         y + height - borderImgWidth,
+                         borderImgWidth, borderImgWidth,
+                         bi.m_type, bi.m_imgBlob, oneBitColor);
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // bottom
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              for (unsigned iBot = 1; iBot < numImagesHoriz - 1; ++iBot)
+              {
+                double imgX = stretch ?
+                              x + width - borderImgWidth - iBot * stretchedImgWidth :
+                              x + width - borderImgWidth - iBot * (borderImgWidth + borderHorizPadding);
+                writeImage(painter,
+                  imgX, y + height - borderImgWidth,
+                  borderImgWidth, stretchedImgWidth,
+                  bi.m_type, bi.m_imgBlob, oneBitColor);
+              }
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // bottom left
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              writeImage(painter, x, y + height - borderImgWidth,
+                         borderImgWidth, borderImgWidth,
+                         bi.m_type, bi.m_imgBlob, oneBitColor);
+            }
+            if (iOffset + 1 != ba.m_offsets.end())
+            {
+              ++iOffset;
+            }
+            // left
+            iOrdOff = find(ba.m_offsetsOrdered.begin(),
+                           ba.m_offsetsOrdered.end(), *iOffset) - ba.m_offsetsOrdered.begin();
+            if (iOrdOff < ba.m_images.size())
+            {
+              const BorderImgInfo &bi = ba.m_images[iOrdOff];
+              for (unsigned iLeft = 1; iLeft < numImagesVert - 1; ++iLeft)
+              {
+                double imgY = stretch ?
+                              y + height - borderImgWidth - iLeft * stretchedImgHeight :
+                              y + height - borderImgWidth -
+                              iLeft * (borderImgWidth + borderVertPadding);
+                writeImage(painter, x, imgY, stretchedImgHeight, borderImgWidth,
+                           bi.m_type, bi.m_imgBlob, oneBitColor);
+              }
+            }
+          }
+        }
+      }
+    }
+    else
+    {
+      Coordinate strokeCoord = isShapeTypeRectangle(type) ?
+                               getFudgedCoordinates(coord, lines, true, borderPosition) : coord;
+      double x, y, height, width;
+      x = strokeCoord.getXIn(m_model.m_width);
+      y = strokeCoord.getYIn(m_model.m_height);
+      height = strokeCoord.getHeightIn();
+      width = strokeCoord.getWidthIn();
+      graphicsProps.insert("draw:fill", "none");
+      if (bool(extra.m_dash) && !extra.m_dash.get().m_dots.empty())
+      {
+        const Dash &dash = extra.m_dash.get();
+        graphicsProps.insert("draw:stroke", "dash");
+        graphicsProps.insert("draw:distance", dash.m_distance, librevenge::RVNG_INCH);
+        switch (dash.m_dotStyle)
+        {
+        case ROUND_DOT:
+          graphicsProps.insert("svg:stroke-linecap", "round");
+          break;
+        case RECT_DOT:
+          graphicsProps.insert("svg:stroke-linecap", "butt");
+          break;
+        default:
+          break;
+        }
+        for (size_t i = 0; i < dash.m_dots.size(); ++i)
+        {
+          librevenge::RVNGString dots;
+          dots.sprintf("draw:dots%ld", i + 1);
+          graphicsProps.insert(dots.cstr(), static_cast<int>(dash.m_dots[i].m_count));
+          if (bool(dash.m_dots[i].m_length))
+          {
+            librevenge::RVNGString length;
+            length.sprintf("draw:dots%ld-length", i + 1);
+            graphicsProps.insert(length.cstr(), dash.m_dots[i].m_length.get(), librevenge::RVNG_INCH);
+          }
+        }
+      }
+      else
+      {
+        graphicsProps.insert("draw:stroke", "solid");
+      }
+      painter->setStyle(graphicsProps);
+      writeCustomShape(type, graphicsProps, painter, x, y, height, width,
+                       false, foldedTransform, lines, calculator,
+                       m_model.m_paletteColors, customShape);
+    }
+  }
+  if (hasText)
+  {
+    const std::vector<TextParagraph> &text = *maybeText;
+    graphicsProps.insert("draw:fill", "none");
+    Coordinate textCoord = isShapeTypeRectangle(type) ?
+                           getFudgedCoordinates(coord, lines, false, borderPosition) : coord;
+    painter->setStyle(graphicsProps);
+    librevenge::RVNGPropertyList props;
+    setRectCoordProps(textCoord, &props);
+    double textRotation = thisTransform.getRotation();
+    if (textRotation != 0)
+    {
+      props.insert("librevenge:rotate", textRotation * 180 / M_PI);
+    }
+
+    if (isTable)
+    {
+      librevenge::RVNGPropertyListVector columnWidths;
+      for (unsigned int col : get(extra.m_tableInfo).m_columnWidthsInEmu)
+      {
+        librevenge::RVNGPropertyList columnWidth;
+        columnWidth.insert("style:column-width", double(col) / EMUS_IN_INCH);
+        columnWidths.append(columnWidth);
+      }
+      props.insert("librevenge:table-columns", columnWidths);
+
+      painter->startTableObject(props);
+
+      const SeqNumMap<std::vector<unsigned> >::const_iterator it = m_model.m_tableCellTextEndsByTextId.find(get(info.m_textId));
+      const std::vector<unsigned> &tableCellTextEnds = (it != m_model.m_tableCellTextEndsByTextId.end()) ? it->second : std::vector<unsigned>();
+
+      TableLayout tableLayout(boost::extents[get(extra.m_tableInfo).m_numRows][get(extra.m_tableInfo).m_numColumns]);
+      createTableLayout(get(extra.m_tableInfo).m_cells, tableLayout);
+
+      ParagraphToCellMap_t paraToCellMap;
+      ParagraphTexts_t paraTexts;
+      mapTableTextToCells(text, tableCellTextEnds, m_encoding, paraToCellMap, paraTexts);
+
+      for (unsigned row = 0; row != tableLayout.shape()[0]; ++row)
+      {
+        librevenge::RVNGPropertyList rowProps;
+        if (row < (get(extra.m_tableInfo).m_rowHeightsInEmu.size()))
+          rowProps.insert("librevenge:row-height", double(get(extra.m_tableInfo).m_rowHeightsInEmu[row]) / EMUS_IN_INCH);
+        painter->openTableRow(rowProps);
+
+        for (unsigned col = 0; col != tableLayout.shape()[1]; ++col)
+        {
+          librevenge::RVNGPropertyList cellProps;
+          cellProps.insert("librevenge:column", int(col));
+          cellProps.insert("librevenge:row", int(row));
+
+          if (isCovered(tableLayout[row][col]))
+          {
+            painter->insertCoveredTableCell(cellProps);
+          }
+          else
+          {
+            if (tableLayout[row][col].m_colSpan > 1)
+              cellProps.insert("table:number-columns-spanned", int(tableLayout[row][col].m_colSpan));
+            if (tableLayout[row][col].m_rowSpan > 1)
+              cellProps.insert("table:number-rows-spanned", int(tableLayout[row][col].m_rowSpan));
+
+            painter->openTableCell(cellProps);
+
+            if (tableLayout[row][col].m_cell < paraToCellMap.size())
+            {
+              const std::pair<unsigned, unsigned> &cellParas = paraToCellMap[tableLayout[row][col].m_cell];
+              for (unsigned para = cellParas.first; para <= cellParas.second; ++para)
+              {
+                librevenge::RVNGPropertyList paraProps = getParaStyleProps(text[para].style, text[para].style.m_defaultCharStyleIndex);
+                painter->openParagraph(paraProps);
+
+                for (size_t i_spans = 0; i_spans < paraTexts[para].size(); ++i_spans)
+                {
+                  librevenge::RVNGPropertyList charProps = getCharStyleProps(text[para].spans[i_spans].style, text[para].style.m_defaultCharStyleIndex);
+                  painter->openSpan(charProps);
+                  separateSpacesAndInsertText(painter, paraTexts[para][i_spans]);
+                  painter->closeSpan();
+                }
+
+                painter->closeParagraph();
+              }
+            }
+
+            painter->closeTableCell();
+          }
+        }
+
+        painter->closeTableRow();
+      }
+
+      painter->endTableObject();
+    }
+    else // a text object
+    {
+      Margins margins = info.m_margins.get_value_or(Margins());
+      props.insert("fo:padding-left", (double)margins.m_left / EMUS_IN_INCH);
+      props.insert("fo:padding-top", (double)margins.m_top / EMUS_IN_INCH);
+      props.insert("fo:padding-right", (double)margins.m_right / EMUS_IN_INCH);
+      props.insert("fo:padding-bottom", (double)margins.m_bottom / EMUS_IN_INCH);
+      if (bool(extra.m_verticalAlign))
+      {
+        switch (extra.m_verticalAlign.get())
+        {
+        default:
+        case TOP:
+          props.insert("draw:textarea-vertical-align", "top");
+          break;
+        case MIDDLE:
+          props.insert("draw:textarea-vertical-align", "middle");
+          break;
+        case BOTTOM:
+          props.insert("draw:textarea-vertical-align", "bottom");
+          break;
+        }
+      }
+      if (extra.m_numColumns)
+      {
+        unsigned ncols = extra.m_numColumns.get_value_or(0);
+        if (ncols > 0)
+          props.insert("fo:column-count", (int)ncols);
+      }
+      if (extra.m_columnSpacing)
+      {
+        unsigned ngap = extra.m_columnSpacing;
+        if (ngap > 0)
+          props.insert("fo:column-gap", (double)ngap / EMUS_IN_INCH);
+      }
+      painter->startTextObject(props);
+      for (const auto &line : text)
+      {
+        librevenge::RVNGPropertyList paraProps = getParaStyleProps(line.style, line.style.m_defaultCharStyleIndex);
+        painter->openParagraph(paraProps);
+        for (size_t i_spans = 0; i_spans < line.spans.size(); ++i_spans)
+        {
+          librevenge::RVNGString textString;
+          appendCharacters(textString, line.spans[i_spans].chars,
+                           m_encoding);
+          librevenge::RVNGPropertyList charProps = getCharStyleProps(line.spans[i_spans].style, line.style.m_defaultCharStyleIndex);
+          painter->openSpan(charProps);
+          separateSpacesAndInsertText(painter, textString);
+          painter->closeSpan();
+        }
+        painter->closeParagraph();
+      }
+      painter->endTextObject();
+    }
+  }
+  if (makeLayer)
+  {
+    painter->endLayer();
+  }
+  return &no_op;
+}
+
+void MSPUBEmitter::writeImage(librevenge::RVNGDrawingInterface *const painter, double x, double y,
+                                double height, double width, ImgType type, const librevenge::RVNGBinaryData &blob,
+                                boost::optional<Color> oneBitColor) const
+{
+  librevenge::RVNGPropertyList props;
+  if (bool(oneBitColor))
+  {
+    Color obc = oneBitColor.get();
+    props.insert("draw:color-mode", "greyscale");
+    props.insert("draw:red", static_cast<double>(obc.r) / 255.0, librevenge::RVNG_PERCENT);
+    props.insert("draw:blue", static_cast<double>(obc.b) / 255.0, librevenge::RVNG_PERCENT);
+    props.insert("draw:green", static_cast<double>(obc.g) / 255.0, librevenge::RVNG_PERCENT);
+  }
+  props.insert("svg:x", x);
+  props.insert("svg:y", y);
+  props.insert("svg:width", width);
+  props.insert("svg:height", height);
+  props.insert("librevenge:mime-type", mimeByImgType(type));
+  props.insert("office:binary-data", blob);
+  painter->drawGraphicObject(props);
+}
+
+librevenge::RVNGPropertyList MSPUBEmitter::getParaStyleProps(const ParagraphStyle &style, boost::optional<unsigned> defaultParaStyleIndex) const
+{
+  ParagraphStyle _nothing;
+  const ParagraphStyle &defaultStyle = bool(defaultParaStyleIndex) && defaultParaStyleIndex.get() < m_model.m_defaultParaStyles.size() ? m_model.m_defaultParaStyles[defaultParaStyleIndex.get()] : _nothing;
+  librevenge::RVNGPropertyList ret;
+  Alignment align = style.m_align.get_value_or(
+                      defaultStyle.m_align.get_value_or(LEFT));
+  switch (align)
+  {
+  case RIGHT:
+    ret.insert("fo:text-align", "right");
+    break;
+  case CENTER:
+    ret.insert("fo:text-align", "center");
+    break;
+  case JUSTIFY:
+    ret.insert("fo:text-align", "justify");
+    break;
+  case LEFT:
+  default:
+    ret.insert("fo:text-align", "left");
+    break;
+  }
+  LineSpacingInfo info = style.m_lineSpacing.get_value_or(
+                           defaultStyle.m_lineSpacing.get_value_or(LineSpacingInfo()));
+  LineSpacingType lineSpacingType = info.m_type;
+  double lineSpacing = info.m_amount;
+  if (!(lineSpacingType == LINE_SPACING_SP && lineSpacing == 1))
+  {
+    if (lineSpacingType == LINE_SPACING_SP)
+    {
+      ret.insert("fo:line-height", lineSpacing, librevenge::RVNG_PERCENT);
+    }
+    else if (lineSpacingType == LINE_SPACING_PT)
+    {
+      ret.insert("fo:line-height", lineSpacing, librevenge::RVNG_POINT);
+    }
+  }
+  unsigned spaceAfterEmu = style.m_spaceAfterEmu.get_value_or(
+                             defaultStyle.m_spaceAfterEmu.get_value_or(0));
+  unsigned spaceBeforeEmu = style.m_spaceBeforeEmu.get_value_or(
+                              defaultStyle.m_spaceBeforeEmu.get_value_or(0));
+  int firstLineIndentEmu = style.m_firstLineIndentEmu.get_value_or(
+                             defaultStyle.m_firstLineIndentEmu.get_value_or(0));
+  unsigned leftIndentEmu = style.m_leftIndentEmu.get_value_or(
+                             defaultStyle.m_leftIndentEmu.get_value_or(0));
+  unsigned rightIndentEmu = style.m_rightIndentEmu.get_value_or(
+                              defaultStyle.m_rightIndentEmu.get_value_or(0));
+  if (spaceAfterEmu != 0)
+  {
+    ret.insert("fo:margin-bottom", (double)spaceAfterEmu / EMUS_IN_INCH);
+  }
+  if (spaceBeforeEmu != 0)
+  {
+    ret.insert("fo:margin-top", (double)spaceBeforeEmu / EMUS_IN_INCH);
+  }
+  if (firstLineIndentEmu != 0)
+  {
+    ret.insert("fo:text-indent", (double)firstLineIndentEmu / EMUS_IN_INCH);
+  }
+  if (leftIndentEmu != 0)
+  {
+    ret.insert("fo:margin-left", (double)leftIndentEmu / EMUS_IN_INCH);
+  }
+  if (rightIndentEmu != 0)
+  {
+    ret.insert("fo:margin-right", (double)rightIndentEmu / EMUS_IN_INCH);
+  }
+  unsigned dropCapLines = style.m_dropCapLines.get_value_or(
+                            defaultStyle.m_dropCapLines.get_value_or(0));
+  if (dropCapLines != 0)
+  {
+    ret.insert("style:drop-cap", (int)dropCapLines);
+  }
+  unsigned dropCapLetters = style.m_dropCapLetters.get_value_or(
+                              defaultStyle.m_dropCapLetters.get_value_or(0));
+  if (dropCapLetters != 0)
+  {
+    ret.insert("style:length", (int)dropCapLetters);
+  }
+  return ret;
+}
+
+librevenge::RVNGPropertyList MSPUBEmitter::getCharStyleProps(const CharacterStyle &style, boost::optional<unsigned> defaultCharStyleIndex) const
+{
+  CharacterStyle _nothing;
+  if (!defaultCharStyleIndex)
+  {
+    defaultCharStyleIndex = 0;
+  }
+  const CharacterStyle &defaultCharStyle = defaultCharStyleIndex.get() < m_model.m_defaultCharStyles.size() ? m_model.m_defaultCharStyles[defaultCharStyleIndex.get()] : _nothing;
+  librevenge::RVNGPropertyList ret;
+  if (style.italic ^ defaultCharStyle.italic)
+  {
+    ret.insert("fo:font-style", "italic");
+  }
+  if (style.bold ^ defaultCharStyle.bold)
+  {
+    ret.insert("fo:font-weight", "bold");
+  }
+  if (style.outline ^ defaultCharStyle.outline)
+    ret.insert("style:text-outline", "true");
+  if (style.shadow ^ defaultCharStyle.shadow)
+    ret.insert("fo:text-shadow", "1pt 1pt");
+  if (style.smallCaps ^ defaultCharStyle.smallCaps)
+    ret.insert("fo:font-variant", "small-caps");
+  else if (style.allCaps ^ defaultCharStyle.allCaps)
+    ret.insert("fo:text-transform", "uppercase");
+  if (style.emboss ^ defaultCharStyle.emboss)
+    ret.insert("style:font-relief", "embossed");
+  else if (style.engrave ^ defaultCharStyle.engrave)
+    ret.insert("style:font-relief", "engraved");
+  if (style.underline)
+    fillUnderline(ret, get(style.underline));
+  else if (defaultCharStyle.underline)
+    fillUnderline(ret, get(defaultCharStyle.underline));
+  if (style.textScale)
+    ret.insert("fo:text-scale", get(style.textScale), librevenge::RVNG_PERCENT);
+  else if (defaultCharStyle.textScale)
+    ret.insert("fo:text-scale", get(defaultCharStyle.textScale), librevenge::RVNG_PERCENT);
+  if (bool(style.textSizeInPt))
+  {
+    ret.insert("fo:font-size", style.textSizeInPt.get() / POINTS_IN_INCH);
+  }
+  else if (bool(defaultCharStyle.textSizeInPt))
+  {
+    ret.insert("fo:font-size", defaultCharStyle.textSizeInPt.get()
+               / POINTS_IN_INCH);
+  }
+  if (style.colorIndex >= 0 && (size_t)style.colorIndex < m_model.m_textColors.size())
+  {
+    ret.insert("fo:color", getColorString(m_model.m_textColors[style.colorIndex].getFinalColor(m_model.m_paletteColors)));
+  }
+  else if (defaultCharStyle.colorIndex >= 0 && (size_t)defaultCharStyle.colorIndex < m_model.m_textColors.size())
+  {
+    ret.insert("fo:color", getColorString(m_model.m_textColors[defaultCharStyle.colorIndex].getFinalColor(m_model.m_paletteColors)));
+  }
+  else
+  {
+    ret.insert("fo:color", getColorString(Color(0, 0, 0)));  // default color is black
+  }
+  if (bool(style.fontIndex) &&
+      style.fontIndex.get() < m_model.m_fonts.size())
+  {
+    librevenge::RVNGString str;
+    appendCharacters(str, m_model.m_fonts[style.fontIndex.get()],
+                     m_encoding);
+    ret.insert("style:font-name", str);
+  }
+  else if (bool(defaultCharStyle.fontIndex) &&
+           defaultCharStyle.fontIndex.get() < m_model.m_fonts.size())
+  {
+    librevenge::RVNGString str;
+    appendCharacters(str, m_model.m_fonts[defaultCharStyle.fontIndex.get()],
+                     m_encoding);
+    ret.insert("style:font-name", str);
+  }
+  else if (!m_model.m_fonts.empty())
+  {
+    librevenge::RVNGString str;
+    appendCharacters(str, m_model.m_fonts[0],
+                     m_encoding);
+    ret.insert("style:font-name", str);
+  }
+  switch (style.superSubType)
+  {
+  case SUPERSCRIPT:
+    ret.insert("style:text-position", "50% 67%");
+    break;
+  case SUBSCRIPT:
+    ret.insert("style:text-position", "-50% 67%");
+    break;
+  default:
+    break;
+  }
+  if (style.lcid)
+    fillLocale(ret, get(style.lcid));
+  else if (defaultCharStyle.lcid)
+    fillLocale(ret, get(defaultCharStyle.lcid));
+  return ret;
+}
+
+librevenge::RVNGString MSPUBEmitter::getColorString(const Color &color)
+{
+  librevenge::RVNGString ret;
+  ret.sprintf("#%.2x%.2x%.2x",(unsigned char)color.r, (unsigned char)color.g, (unsigned char)color.b);
+  MSPUB_DEBUG_MSG(("String for r: 0x%x, g: 0x%x, b: 0x%x is %s\n", color.r, color.g, color.b, ret.cstr()));
+  return ret;
+}
+
+void MSPUBEmitter::writePage(librevenge::RVNGDrawingInterface *const painter, unsigned pageSeqNum) const
+{
+  const MSPUBDocumentModel::PageInfo &pageInfo = m_model.m_pagesBySeqNum.find(pageSeqNum)->second;
+  librevenge::RVNGPropertyList pageProps;
+  if (m_model.m_widthSet)
+  {
+    pageProps.insert("svg:width", m_model.m_width);
+  }
+  if (m_model.m_heightSet)
+  {
+    pageProps.insert("svg:height", m_model.m_height);
+  }
+  const auto &shapeGroupsOrdered = pageInfo.m_shapeGroupsOrdered;
+  if (!shapeGroupsOrdered.empty())
+  {
+    painter->startPage(pageProps);
+    boost::optional<unsigned> masterSeqNum = m_model.getMasterPageSeqNum(pageSeqNum);
+    auto hasMaster = bool(masterSeqNum);
+    if (hasMaster)
+    {
+      writePageBackground(painter, masterSeqNum.get());
+    }
+    writePageBackground(painter, pageSeqNum);
+    if (hasMaster)
+    {
+      writePageShapes(painter, masterSeqNum.get());
+    }
+    writePageShapes(painter, pageSeqNum);
+    painter->endPage();
+  }
+}
+
+void MSPUBEmitter::writePageShapes(librevenge::RVNGDrawingInterface *const painter, unsigned pageSeqNum) const
+{
+  const MSPUBDocumentModel::PageInfo &pageInfo = m_model.m_pagesBySeqNum.find(pageSeqNum)->second;
+  for (const auto &shapeGroup : pageInfo.m_shapeGroupsOrdered)
+    shapeGroup->visit(std::bind(&MSPUBEmitter::paintShape, this, painter, _1, _2, _3, _4, _5));
+}
+
+void MSPUBEmitter::writePageBackground(librevenge::RVNGDrawingInterface *const painter, unsigned pageSeqNum) const
+{
+  const unsigned *ptr_fillSeqNum = getIfExists_const(m_model.m_bgShapeSeqNumsByPageSeqNum, pageSeqNum);
+  if (ptr_fillSeqNum)
+  {
+    std::shared_ptr<const Fill> ptr_fill;
+    const ShapeInfo *ptr_info = getIfExists_const(m_model.m_shapeInfosBySeqNum, *ptr_fillSeqNum);
+    if (ptr_info)
+    {
+      ptr_fill = ptr_info->m_fill;
+    }
+    if (ptr_fill)
+    {
+      ShapeInfo bg;
+      bg.m_type = RECTANGLE;
+      Coordinate wholePage(-m_model.m_width/2 * EMUS_IN_INCH, -m_model.m_height/2 * EMUS_IN_INCH, m_model.m_width/2 * EMUS_IN_INCH, m_model.m_height/2 * EMUS_IN_INCH);
+      bg.m_coordinates = wholePage;
+      bg.m_pageSeqNum = pageSeqNum;
+      bg.m_fill = ptr_fill;
+      bg.resolveGeometry();
+      paintShape(painter, bg, Coordinate(), VectorTransformation2D(), false, VectorTransformation2D());
+    }
+  }
+}
+
+bool MSPUBEmitter::emit(librevenge::RVNGDrawingInterface *const painter) const
+{
+  painter->startDocument(librevenge::RVNGPropertyList());
+  painter->setDocumentMetaData(m_model.m_metaData);
+
+  for (std::list<EmbeddedFontInfo>::const_iterator i = m_model.m_embeddedFonts.begin(); i != m_model.m_embeddedFonts.end(); ++i)
+  {
+    librevenge::RVNGPropertyList props;
+    props.insert("librevenge:name", i->m_name);
+    props.insert("librevenge:mime-type", "application/vnd.ms-fontobject");
+    props.insert("office:binary-data",i->m_blob);
+    painter->defineEmbeddedFont(props);
+  }
+
+  const std::vector<unsigned> pageSeqNums = m_model.getOrderedPageSeqNums();
+  for (unsigned i = 0; i < pageSeqNums.size(); ++i)
+  {
+    if (m_model.isPageSelected(i))
+    {
+      writePage(painter, pageSeqNums[i]);
+    }
+  }
+  painter->endDocument();
+  return true;
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
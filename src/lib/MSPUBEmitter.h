@@ -0,0 +1,67 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MSPUBEMITTER_H
+#define INCLUDED_MSPUBEMITTER_H
+
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <librevenge/librevenge.h>
+
+#include "MSPUBDocumentModel.h"
+#include "MSPUBTypes.h"
+
+namespace libmspub
+{
+
+class VectorTransformation2D;
+
+struct Coordinate;
+
+/* Paints a completed document model. The model is only read, so several
+ * emitters can paint it at the same time.
+ */
+class MSPUBEmitter
+{
+public:
+  explicit MSPUBEmitter(const MSPUBDocumentModel &model);
+
+  bool emit(librevenge::RVNGDrawingInterface *painter) const;
+
+  static librevenge::RVNGString getColorString(const Color &);
+
+private:
+  MSPUBEmitter(const MSPUBEmitter &);
+  MSPUBEmitter &operator=(const MSPUBEmitter &);
+
+  const MSPUBDocumentModel &m_model;
+  const char *const m_encoding;
+
+  void setRectCoordProps(Coordinate, librevenge::RVNGPropertyList *) const;
+  const std::vector<libmspub::TextParagraph> *getShapeText(const ShapeInfo &info) const;
+  void writePage(librevenge::RVNGDrawingInterface *painter, unsigned pageSeqNum) const;
+  void writePageShapes(librevenge::RVNGDrawingInterface *painter, unsigned pageSeqNum) const;
+  void writePageBackground(librevenge::RVNGDrawingInterface *painter, unsigned pageSeqNum) const;
+  void writeImage(librevenge::RVNGDrawingInterface *painter, double x, double y, double height, double width,
+                  ImgType type, const librevenge::RVNGBinaryData &blob,
+                  boost::optional<Color> oneBitColor) const;
+
+  std::function<void(void)> paintShape(librevenge::RVNGDrawingInterface *painter, const ShapeInfo &info, const Coordinate &relativeTo, const VectorTransformation2D &foldedTransform, bool isGroup, const VectorTransformation2D &thisTransform) const;
+
+  librevenge::RVNGPropertyList getCharStyleProps(const CharacterStyle &, boost::optional<unsigned> defaultCharStyleIndex) const;
+  librevenge::RVNGPropertyList getParaStyleProps(const ParagraphStyle &, boost::optional<unsigned> defaultParaStyleIndex) const;
+};
+
+} // namespace libmspub
+
+#endif /* INCLUDED_MSPUBEMITTER_H */
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
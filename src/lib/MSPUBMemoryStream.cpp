@@ -0,0 +1,122 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MSPUBMemoryStream.h"
+
+namespace libmspub
+{
+
+MSPUBMemoryStream::MSPUBMemoryStream(librevenge::RVNGInputStream *input)
+  : m_owner(), m_data(nullptr), m_size(0), m_pos(0)
+{
+  copyFrom(input, input ? getLength(input) : 0);
+}
+
+MSPUBMemoryStream::MSPUBMemoryStream(std::unique_ptr<librevenge::RVNGInputStream> input)
+  : m_owner(), m_data(nullptr), m_size(0), m_pos(0)
+{
+  if (!input)
+  {
+    copyFrom(nullptr, 0);
+    return;
+  }
+  const unsigned long length = getLength(input.get());
+  if (length > 0 && 0 == input->seek(0, librevenge::RVNG_SEEK_SET))
+  {
+    // The pointer stays valid until the next call on the source; as
+    // nothing else holds it, there will be none.
+    unsigned long numBytesRead = 0;
+    const unsigned char *const p = input->read(length, numBytesRead);
+    if (p && numBytesRead == length)
+    {
+      m_owner = std::shared_ptr<librevenge::RVNGInputStream>(std::move(input));
+      m_data = p;
+      m_size = length;
+      return;
+    }
+  }
+  copyFrom(input.get(), length);
+}
+
+MSPUBMemoryStream::MSPUBMemoryStream(const std::shared_ptr<const void> &owner, const unsigned char *const data, const unsigned long size)
+  : m_owner(owner), m_data(data), m_size(size), m_pos(0)
+{
+}
+
+MSPUBMemoryStream::~MSPUBMemoryStream()
+{
+}
+
+void MSPUBMemoryStream::copyFrom(librevenge::RVNGInputStream *const input, const unsigned long length)
+{
+  std::shared_ptr<std::vector<unsigned char> > buffer(new std::vector<unsigned char>());
+  if (input)
+  {
+    buffer->reserve(length);
+    input->seek(0, librevenge::RVNG_SEEK_SET);
+    while (!input->isEnd())
+    {
+      unsigned long numBytesRead = 0;
+      const unsigned char *const p = input->read(length > buffer->size() ? length - buffer->size() : 4096, numBytesRead);
+      if (!p || numBytesRead == 0)
+        break;
+      buffer->insert(buffer->end(), p, p + numBytesRead);
+    }
+  }
+  m_owner = buffer;
+  m_data = buffer->data();
+  m_size = buffer->size();
+}
+
+std::unique_ptr<MSPUBMemoryStream> MSPUBMemoryStream::openSubStream(librevenge::RVNGInputStream *const input, const char *const name)
+{
+  std::unique_ptr<librevenge::RVNGInputStream> subStream(input->getSubStreamByName(name));
+  if (!subStream)
+    return std::unique_ptr<MSPUBMemoryStream>();
+  return std::unique_ptr<MSPUBMemoryStream>(new MSPUBMemoryStream(std::move(subStream)));
+}
+
+std::unique_ptr<MSPUBMemoryStream> MSPUBMemoryStream::clone() const
+{
+  return std::unique_ptr<MSPUBMemoryStream>(new MSPUBMemoryStream(m_owner, m_data, m_size));
+}
+
+bool MSPUBMemoryStream::isStructured()
+{
+  return false;
+}
+
+unsigned MSPUBMemoryStream::subStreamCount()
+{
+  return 0;
+}
+
+const char *MSPUBMemoryStream::subStreamName(unsigned)
+{
+  return nullptr;
+}
+
+bool MSPUBMemoryStream::existsSubStream(const char *)
+{
+  return false;
+}
+
+librevenge::RVNGInputStream *MSPUBMemoryStream::getSubStreamByName(const char *)
+{
+  return nullptr;
+}
+
+librevenge::RVNGInputStream *MSPUBMemoryStream::getSubStreamById(unsigned)
+{
+  return nullptr;
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,209 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MSPUBMEMORYSTREAM_H
+#define INCLUDED_MSPUBMEMORYSTREAM_H
+
+#include <memory>
+#include <vector>
+
+#include <librevenge/librevenge.h>
+
+#include "libmspub_utils.h"
+
+namespace libmspub
+{
+
+/* A substream held in one contiguous buffer. The class is final and its
+ * accessors are inline, so the parsers, which take it by its concrete
+ * type, read it without going through virtual calls.
+ *
+ * The buffer is either a copy of the source or, if the source hands out
+ * its whole content from a single read, borrowed from the source, which
+ * is then kept alive with it. It is immutable and may be shared by
+ * several streams, each with its own position (see clone()).
+ */
+class MSPUBMemoryStream final : public librevenge::RVNGInputStream
+{
+public:
+  // copies the content of input
+  explicit MSPUBMemoryStream(librevenge::RVNGInputStream *input);
+  // takes ownership of input, and borrows its buffer if it can
+  explicit MSPUBMemoryStream(std::unique_ptr<librevenge::RVNGInputStream> input);
+  ~MSPUBMemoryStream() override;
+
+  // returns null if the substream does not exist
+  static std::unique_ptr<MSPUBMemoryStream> openSubStream(librevenge::RVNGInputStream *input, const char *name);
+
+  // Returns a stream over the same data, positioned at its start. It can
+  // be read concurrently with this one.
+  std::unique_ptr<MSPUBMemoryStream> clone() const;
+
+  bool isStructured() override;
+  unsigned subStreamCount() override;
+  const char *subStreamName(unsigned id) override;
+  bool existsSubStream(const char *name) override;
+  librevenge::RVNGInputStream *getSubStreamByName(const char *name) override;
+  librevenge::RVNGInputStream *getSubStreamById(unsigned id) override;
+
+  const unsigned char *read(unsigned long numBytes, unsigned long &numBytesRead) override
+  {
+    numBytesRead = 0;
+    if (numBytes == 0 || m_pos >= m_size)
+      return nullptr;
+    numBytesRead = numBytes < m_size - m_pos ? numBytes : m_size - m_pos;
+    const unsigned char *const p = m_data + m_pos;
+    m_pos += numBytesRead;
+    return p;
+  }
+
+  int seek(long offset, librevenge::RVNG_SEEK_TYPE seekType) override
+  {
+    long pos = offset;
+    if (seekType == librevenge::RVNG_SEEK_CUR)
+      pos += long(m_pos);
+    else if (seekType == librevenge::RVNG_SEEK_END)
+      pos += long(m_size);
+    if (pos < 0)
+    {
+      m_pos = 0;
+      return -1;
+    }
+    if ((unsigned long)pos > m_size)
+    {
+      m_pos = m_size;
+      return -1;
+    }
+    m_pos = (unsigned long)pos;
+    return 0;
+  }
+
+  long tell() override
+  {
+    return long(m_pos);
+  }
+
+  bool isEnd() override
+  {
+    return m_pos >= m_size;
+  }
+
+  unsigned long size() const
+  {
+    return m_size;
+  }
+
+  const unsigned char *getDataBuffer() const
+  {
+    return m_data;
+  }
+
+  // Reads up to length bytes without copying; the reader stays valid for
+  // the lifetime of the stream.
+  SpanReader readSpan(unsigned long length)
+  {
+    const unsigned long base = m_pos;
+    unsigned long numBytesRead = 0;
+    const unsigned char *const p = read(length, numBytesRead);
+    return SpanReader(p, numBytesRead, base);
+  }
+
+  const unsigned char *readExactly(unsigned long length)
+  {
+    if (m_size - m_pos < length)
+    {
+      MSPUB_DEBUG_MSG(("Reading past the end of a memory stream at 0x%lx\n", m_pos));
+      m_pos = m_size;
+      throw EndOfStreamException();
+    }
+    const unsigned char *const p = m_data + m_pos;
+    m_pos += length;
+    return p;
+  }
+
+private:
+  MSPUBMemoryStream(const std::shared_ptr<const void> &owner, const unsigned char *data, unsigned long size);
+  MSPUBMemoryStream(const MSPUBMemoryStream &);
+  MSPUBMemoryStream &operator=(const MSPUBMemoryStream &);
+
+  void copyFrom(librevenge::RVNGInputStream *input, unsigned long length);
+
+  // whatever keeps m_data alive: a buffer of our own or the source stream
+  std::shared_ptr<const void> m_owner;
+  const unsigned char *m_data;
+  unsigned long m_size;
+  unsigned long m_pos;
+};
+
+// Overloads of the libmspub_utils.h readers that bind statically.
+
+inline uint8_t readU8(MSPUBMemoryStream *input)
+{
+  return *input->readExactly(1);
+}
+
+inline uint16_t readU16(MSPUBMemoryStream *input)
+{
+  return decodeU16(input->readExactly(2));
+}
+
+inline uint32_t readU32(MSPUBMemoryStream *input)
+{
+  return decodeU32(input->readExactly(4));
+}
+
+inline uint64_t readU64(MSPUBMemoryStream *input)
+{
+  return decodeU64(input->readExactly(8));
+}
+
+inline int8_t readS8(MSPUBMemoryStream *input)
+{
+  return (int8_t)readU8(input);
+}
+
+inline int16_t readS16(MSPUBMemoryStream *input)
+{
+  return (int16_t)readU16(input);
+}
+
+inline int32_t readS32(MSPUBMemoryStream *input)
+{
+  return (int32_t)readU32(input);
+}
+
+inline double readFixedPoint(MSPUBMemoryStream *input)
+{
+  return toFixedPoint(readS32(input));
+}
+
+inline SpanReader readSpan(MSPUBMemoryStream *input, unsigned long length)
+{
+  return input->readSpan(length);
+}
+
+inline void readNBytes(MSPUBMemoryStream *input, unsigned long length, std::vector<unsigned char> &out)
+{
+  if (length == 0)
+  {
+    MSPUB_DEBUG_MSG(("Attempt to read 0 bytes!"));
+    return;
+  }
+  input->readSpan(length).readNBytes(length, out);
+}
+
+inline bool stillReading(MSPUBMemoryStream *input, unsigned long until)
+{
+  return !input->isEnd() && (unsigned long)input->tell() < until;
+}
+
+}
+
+#endif // INCLUDED_MSPUBMEMORYSTREAM_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
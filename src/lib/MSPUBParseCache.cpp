@@ -0,0 +1,1300 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MSPUBParseCache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <librevenge/librevenge.h>
+
+#include "MSPUBCollector.h"
+#include "MSPUBDocumentContext.h"
+#include "SHA256.h"
+#include "ShapeGroupElement.h"
+#include "libmspub_utils.h"
+
+#ifdef _WIN32
+#include <process.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace libmspub
+{
+
+namespace
+{
+
+// "PUBC"
+const uint32_t CACHE_MAGIC = 0x43425550;
+// Must be increased whenever the document model or its encoding changes.
+const uint32_t CACHE_FORMAT_VERSION = 3;
+
+const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+const unsigned long HASH_CHUNK_SIZE = 0x10000;
+
+// only checks the payload for damage; entries are found by the SHA-256 of
+// the document
+uint64_t fnv1a(uint64_t hash, const unsigned char *const data, const unsigned long length)
+{
+  for (unsigned long i = 0; i < length; ++i)
+  {
+    hash ^= data[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+// Unique to the writer, so that processes or threads storing the same
+// entry at the same time do not write into each other's file.
+std::string getTempPath(const std::string &path)
+{
+#ifdef _WIN32
+  const long pid = _getpid();
+#else
+  const long pid = getpid();
+#endif
+  std::random_device random;
+  char suffix[48];
+  std::snprintf(suffix, sizeof(suffix), ".%ld.%08x.tmp", pid, unsigned(random()));
+  return path + suffix;
+}
+
+// Moves from over to. Unlike std::rename, it also replaces an existing
+// file on Windows.
+bool replaceFile(const std::string &from, const std::string &to)
+{
+#ifdef _WIN32
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+enum FillKind
+{
+  NO_FILL,
+  IMG_FILL,
+  PATTERN_FILL,
+  SOLID_FILL,
+  GRADIENT_FILL
+};
+
+// A value to read into, for types that have no default constructor.
+template <typename T> T blank()
+{
+  return T();
+}
+
+template <> ColorReference blank<ColorReference>()
+{
+  return ColorReference(0);
+}
+
+template <> Dot blank<Dot>()
+{
+  return Dot(0);
+}
+
+template <> Dash blank<Dash>()
+{
+  return Dash(0, RECT_DOT);
+}
+
+template <> Line blank<Line>()
+{
+  return Line(ColorReference(0), 0, false);
+}
+
+template <> Arrow blank<Arrow>()
+{
+  return Arrow(NO_ARROW, SMALL, SMALL);
+}
+
+template <> Shadow blank<Shadow>()
+{
+  return Shadow(OFFSET, 0, 0, 0, 0, 0, 0, 0, ColorReference(0), ColorReference(0));
+}
+
+template <> ListInfo blank<ListInfo>()
+{
+  return ListInfo(0u);
+}
+
+template <> TextSpan blank<TextSpan>()
+{
+  return TextSpan(std::vector<unsigned char>(), CharacterStyle());
+}
+
+template <> TextParagraph blank<TextParagraph>()
+{
+  return TextParagraph(std::vector<TextSpan>(), ParagraphStyle());
+}
+
+template <> TableInfo blank<TableInfo>()
+{
+  return TableInfo(0, 0);
+}
+
+template <> DynamicCustomShape blank<DynamicCustomShape>()
+{
+  return DynamicCustomShape(0, 0);
+}
+
+template <> BorderImgInfo blank<BorderImgInfo>()
+{
+  return BorderImgInfo(UNKNOWN);
+}
+
+template <> EmbeddedFontInfo blank<EmbeddedFontInfo>()
+{
+  return EmbeddedFontInfo(librevenge::RVNGString(), librevenge::RVNGBinaryData());
+}
+
+} // anonymous namespace
+
+class MSPUBParseCache::Writer
+{
+public:
+  Writer() : m_buffer(), m_elementIndices()
+  {
+  }
+
+  const std::vector<unsigned char> &getBuffer() const
+  {
+    return m_buffer;
+  }
+
+  void putU8(const uint8_t value)
+  {
+    m_buffer.push_back(value);
+  }
+  void putU32(const uint32_t value)
+  {
+    for (unsigned i = 0; i < 4; ++i)
+      m_buffer.push_back((unsigned char)(value >> (8 * i)));
+  }
+  void putU64(const uint64_t value)
+  {
+    putU32(uint32_t(value));
+    putU32(uint32_t(value >> 32));
+  }
+  void putBytes(const unsigned char *const data, const unsigned long length)
+  {
+    m_buffer.insert(m_buffer.end(), data, data + length);
+  }
+
+  void put(const bool value)
+  {
+    putU8(value ? 1 : 0);
+  }
+  void put(const unsigned char value)
+  {
+    putU8(value);
+  }
+  void put(const unsigned short value)
+  {
+    putU32(value);
+  }
+  void put(const int value)
+  {
+    putU32(uint32_t(value));
+  }
+  void put(const unsigned value)
+  {
+    putU32(value);
+  }
+  void put(const double value)
+  {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    putU64(bits);
+  }
+  template <typename T>
+  typename std::enable_if<std::is_enum<T>::value>::type put(const T value)
+  {
+    putU32(uint32_t(value));
+  }
+
+  void put(const std::vector<unsigned char> &bytes)
+  {
+    putU32(uint32_t(bytes.size()));
+    m_buffer.insert(m_buffer.end(), bytes.begin(), bytes.end());
+  }
+  void put(const librevenge::RVNGString &str)
+  {
+    putU32(uint32_t(str.size()));
+    m_buffer.insert(m_buffer.end(), str.cstr(), str.cstr() + str.size());
+  }
+  void put(const librevenge::RVNGBinaryData &data)
+  {
+    putU32(uint32_t(data.size()));
+    if (!data.empty())
+      m_buffer.insert(m_buffer.end(), data.getDataBuffer(), data.getDataBuffer() + data.size());
+  }
+
+  template <typename T> void put(const boost::optional<T> &value)
+  {
+    put(bool(value));
+    if (value)
+      put(value.get());
+  }
+  template <typename A, typename B> void put(const std::pair<A, B> &value)
+  {
+    put(value.first);
+    put(value.second);
+  }
+  template <typename T> void put(const std::vector<T> &values)
+  {
+    putSequence(values);
+  }
+  template <typename T> void put(const std::list<T> &values)
+  {
+    putSequence(values);
+  }
+  template <typename T> void put(const std::set<T> &values)
+  {
+    putSequence(values);
+  }
+  template <typename K, typename V> void put(const std::map<K, V> &values)
+  {
+    putSequence(values);
+  }
+  template <typename V> void put(const SeqNumMap<V> &values)
+  {
+    putSequence(values);
+  }
+
+  void put(const Color &color)
+  {
+    put(color.r);
+    put(color.g);
+    put(color.b);
+  }
+  void put(const ColorReference &color)
+  {
+    put(color.getBaseColor());
+    put(color.getModifiedColor());
+  }
+  void put(const CharacterStyle &style)
+  {
+    put(style.underline);
+    put(style.italic);
+    put(style.bold);
+    put(style.textSizeInPt);
+    put(style.colorIndex);
+    put(style.fontIndex);
+    put(style.superSubType);
+    put(style.outline);
+    put(style.shadow);
+    put(style.smallCaps);
+    put(style.allCaps);
+    put(style.emboss);
+    put(style.engrave);
+    put(style.textScale);
+    put(style.lcid);
+  }
+  void put(const LineSpacingInfo &spacing)
+  {
+    put(spacing.m_type);
+    put(spacing.m_amount);
+  }
+  void put(const ListInfo &list)
+  {
+    put(list.m_listType);
+    put(list.m_bulletChar);
+    put(list.m_numberIfRestarted);
+    put(list.m_numberingType);
+    put(list.m_numberingDelimiter);
+  }
+  void put(const ParagraphStyle &style)
+  {
+    put(style.m_align);
+    put(style.m_defaultCharStyleIndex);
+    put(style.m_lineSpacing);
+    put(style.m_spaceBeforeEmu);
+    put(style.m_spaceAfterEmu);
+    put(style.m_firstLineIndentEmu);
+    put(style.m_leftIndentEmu);
+    put(style.m_rightIndentEmu);
+    put(style.m_listInfo);
+    put(style.m_tabStopsInEmu);
+    put(style.m_dropCapLines);
+    put(style.m_dropCapLetters);
+  }
+  void put(const TextSpan &span)
+  {
+    put(span.chars);
+    put(span.style);
+  }
+  void put(const TextParagraph &paragraph)
+  {
+    put(paragraph.spans);
+    put(paragraph.style);
+  }
+  void put(const Dot &dot)
+  {
+    put(dot.m_length);
+    put(dot.m_count);
+  }
+  void put(const Dash &dash)
+  {
+    put(dash.m_distance);
+    put(dash.m_dotStyle);
+    put(dash.m_dots);
+  }
+  void put(const Line &line)
+  {
+    put(line.m_color);
+    put(line.m_widthInEmu);
+    put(line.m_lineExists);
+    put(line.m_dash);
+  }
+  void put(const Arrow &arrow)
+  {
+    put(arrow.m_style);
+    put(arrow.m_width);
+    put(arrow.m_height);
+  }
+  void put(const Shadow &shadow)
+  {
+    put(shadow.m_type);
+    put(shadow.m_offsetXInEmu);
+    put(shadow.m_offsetYInEmu);
+    put(shadow.m_SecondOffsetXInEmu);
+    put(shadow.m_SecondOffsetYInEmu);
+    put(shadow.m_originXInEmu);
+    put(shadow.m_originYInEmu);
+    put(shadow.m_opacity);
+    put(shadow.m_color);
+    put(shadow.m_highColor);
+  }
+  void put(const Margins &margins)
+  {
+    put(margins.m_left);
+    put(margins.m_top);
+    put(margins.m_right);
+    put(margins.m_bottom);
+  }
+  void put(const Coordinate &coord)
+  {
+    put(coord.m_xs);
+    put(coord.m_ys);
+    put(coord.m_xe);
+    put(coord.m_ye);
+  }
+  void put(const CellInfo &cell)
+  {
+    put(cell.m_startRow);
+    put(cell.m_endRow);
+    put(cell.m_startColumn);
+    put(cell.m_endColumn);
+  }
+  void put(const TableInfo &table)
+  {
+    put(table.m_rowHeightsInEmu);
+    put(table.m_columnWidthsInEmu);
+    put(table.m_numRows);
+    put(table.m_numColumns);
+    put(table.m_cells);
+  }
+  void put(const Vertex &vertex)
+  {
+    put(vertex.m_x);
+    put(vertex.m_y);
+  }
+  void put(const Calculation &calc)
+  {
+    put(calc.m_flags);
+    put(calc.m_argOne);
+    put(calc.m_argTwo);
+    put(calc.m_argThree);
+  }
+  void put(const TextRectangle &rect)
+  {
+    put(rect.first);
+    put(rect.second);
+  }
+  void put(const DynamicCustomShape &shape)
+  {
+    put(shape.m_vertices);
+    put(shape.m_elements);
+    put(shape.m_calculations);
+    put(shape.m_defaultAdjustValues);
+    put(shape.m_textRectangles);
+    put(shape.m_gluePoints);
+    put(shape.m_coordWidth);
+    put(shape.m_coordHeight);
+    put(shape.m_adjustShiftMask);
+  }
+  void put(const std::shared_ptr<const Fill> &fill)
+  {
+    if (!fill)
+    {
+      putU8(NO_FILL);
+    }
+    else if (const PatternFill *const pattern = dynamic_cast<const PatternFill *>(fill.get()))
+    {
+      putU8(PATTERN_FILL);
+      put(pattern->getImgIndex());
+      put(pattern->getForeground());
+      put(pattern->getBackground());
+    }
+    else if (const ImgFill *const img = dynamic_cast<const ImgFill *>(fill.get()))
+    {
+      putU8(IMG_FILL);
+      put(img->getImgIndex());
+      put(img->isTexture());
+      put(img->getRotation());
+    }
+    else if (const SolidFill *const solid = dynamic_cast<const SolidFill *>(fill.get()))
+    {
+      putU8(SOLID_FILL);
+      put(solid->getColor());
+      put(solid->getOpacity());
+    }
+    else if (const GradientFill *const gradient = dynamic_cast<const GradientFill *>(fill.get()))
+    {
+      putU8(GRADIENT_FILL);
+      double left = 0;
+      double top = 0;
+      double right = 0;
+      double bottom = 0;
+      gradient->getFillCenter(left, top, right, bottom);
+      put(gradient->getAngle());
+      put(gradient->getType());
+      put(left);
+      put(top);
+      put(right);
+      put(bottom);
+      putU32(uint32_t(gradient->getStops().size()));
+      for (const auto &stop : gradient->getStops())
+      {
+        put(stop.m_colorReference);
+        put(stop.m_offsetPercent);
+        put(stop.m_opacity);
+      }
+    }
+    else
+    {
+      throw GenericException();
+    }
+  }
+  void put(const ShapeInfo &info)
+  {
+    put(info.m_type);
+    put(info.m_imgIndex);
+    put(info.m_coordinates);
+    put(info.m_lines);
+    put(info.m_pageSeqNum);
+    put(info.m_textId);
+    put(info.m_rotation);
+    put(info.m_flips);
+    put(info.m_margins);
+    put(info.m_fill);
+    put(info.m_innerRotation);
+    put(bool(info.m_extra));
+    if (info.m_extra)
+      put(*info.m_extra);
+  }
+  void put(const ShapeExtraInfo &extra)
+  {
+    put(extra.m_cropType);
+    put(extra.m_borderImgIndex);
+    put(extra.m_adjustValuesByIndex);
+    put(extra.m_adjustValues);
+    put(extra.m_borderPosition);
+    put(extra.m_customShape);
+    put(extra.m_stretchBorderArt);
+    put(extra.m_lineBackColor);
+    put(extra.m_dash);
+    put(extra.m_tableInfo);
+    put(extra.m_numColumns);
+    put(extra.m_columnSpacing);
+    put(extra.m_beginArrow);
+    put(extra.m_endArrow);
+    put(extra.m_verticalAlign);
+    put(extra.m_pictureRecolor);
+    put(extra.m_shadow);
+    put(extra.m_clipPath);
+    put(extra.m_pictureBrightness);
+    put(extra.m_pictureContrast);
+  }
+  void put(const ImgInfo &img)
+  {
+    put(img.getType());
+    put(img.isDelayed());
+    if (img.isDelayed())
+    {
+      // delay stream blips are found again in the document itself
+      putU64(img.getOffset());
+      putU64(img.getLength());
+      putU64(img.getSizeHint());
+    }
+    else
+    {
+      put(img.getData());
+    }
+  }
+  void put(const BorderImgInfo &img)
+  {
+    put(img.m_type);
+    put(img.m_imgBlob);
+  }
+  void put(const BorderArtInfo &art)
+  {
+    put(art.m_images);
+    put(art.m_offsets);
+    put(art.m_offsetsOrdered);
+  }
+  void put(const EmbeddedFontInfo &font)
+  {
+    put(font.m_name);
+    put(font.m_blob);
+  }
+
+  void putShapeGroup(const ShapeGroupElement &elt)
+  {
+    const unsigned index = unsigned(m_elementIndices.size());
+    m_elementIndices[&elt] = index;
+    put(elt.getSeqNum());
+    putU32(uint32_t(elt.getChildren().size()));
+    for (const auto &child : elt.getChildren())
+      putShapeGroup(*child);
+  }
+
+  void putModel(const MSPUBDocumentModel &model)
+  {
+    put(model.m_width);
+    put(model.m_height);
+    put(model.m_widthSet);
+    put(model.m_heightSet);
+    put(model.m_textStringsById);
+    // shapes are only assigned to pages by go()
+    putU32(uint32_t(model.m_pagesBySeqNum.size()));
+    for (const auto &page : model.m_pagesBySeqNum)
+      put(page.first);
+    put(model.m_images);
+    put(model.m_borderImages);
+    put(model.m_textColors);
+    put(model.m_fonts);
+    put(model.m_defaultCharStyles);
+    put(model.m_defaultParaStyles);
+    put(model.m_shapeTypesBySeqNum);
+    put(model.m_paletteColors);
+    put(model.m_shapeSeqNumsOrdered);
+    put(model.m_pageSeqNumsByShapeSeqNum);
+    put(model.m_bgShapeSeqNumsByPageSeqNum);
+    put(model.m_skipIfNotBgSeqNums);
+    putU32(uint32_t(model.m_topLevelShapes.size()));
+    for (const auto &shape : model.m_topLevelShapes)
+      putShapeGroup(*shape);
+    putU32(uint32_t(model.m_groupsBySeqNum.size()));
+    for (const auto &group : model.m_groupsBySeqNum)
+    {
+      const auto it = m_elementIndices.find(group.second.get());
+      if (it == m_elementIndices.end())
+        throw GenericException();
+      put(group.first);
+      put(it->second);
+    }
+    put(model.m_embeddedFonts);
+    put(model.m_shapeInfosBySeqNum);
+    put(model.m_masterPages);
+    put(model.m_shapesWithCoordinatesRotated90);
+    put(model.m_masterPagesByPageSeqNum);
+    put(model.m_tableCellTextEndsByTextId);
+    put(model.m_stringOffsetsByTextId);
+    put(model.m_pageSeqNumsOrdered);
+    put(model.m_encodingHeuristic);
+    put(model.m_allText);
+    std::vector<std::pair<librevenge::RVNGString, librevenge::RVNGString> > metaData;
+    librevenge::RVNGPropertyList::Iter it(model.m_metaData);
+    for (it.rewind(); it.next();)
+      metaData.push_back(std::make_pair(librevenge::RVNGString(it.key()), it()->getStr()));
+    put(metaData);
+  }
+
+private:
+  template <typename C> void putSequence(const C &values)
+  {
+    putU32(uint32_t(values.size()));
+    for (const auto &value : values)
+      put(value);
+  }
+
+  std::vector<unsigned char> m_buffer;
+  std::map<const ShapeGroupElement *, unsigned> m_elementIndices;
+};
+
+class MSPUBParseCache::Reader
+{
+public:
+  Reader(const unsigned char *const data, const unsigned long length, MSPUBDocumentContext &context, MSPUBCollector &collector)
+    : m_span(data, length), m_context(context), m_collector(collector), m_elements()
+  {
+  }
+
+  bool isEnd() const
+  {
+    return m_span.isEnd();
+  }
+
+  // The number of elements of a sequence; each takes at least one byte.
+  unsigned getCount()
+  {
+    const unsigned count = m_span.readU32();
+    if (count > m_span.remaining())
+      throw EndOfStreamException();
+    return count;
+  }
+
+  void get(bool &value)
+  {
+    value = m_span.readU8() != 0;
+  }
+  void get(unsigned char &value)
+  {
+    value = m_span.readU8();
+  }
+  void get(unsigned short &value)
+  {
+    value = (unsigned short)m_span.readU32();
+  }
+  void get(int &value)
+  {
+    value = m_span.readS32();
+  }
+  void get(unsigned &value)
+  {
+    value = m_span.readU32();
+  }
+  void get(double &value)
+  {
+    const uint64_t bits = m_span.readU64();
+    std::memcpy(&value, &bits, sizeof(value));
+  }
+  template <typename T>
+  typename std::enable_if<std::is_enum<T>::value>::type get(T &value)
+  {
+    value = T(m_span.readU32());
+  }
+
+  void get(std::vector<unsigned char> &bytes)
+  {
+    m_span.readNBytes(getCount(), bytes);
+  }
+  void get(librevenge::RVNGString &str)
+  {
+    std::vector<unsigned char> bytes;
+    get(bytes);
+    str = std::string(bytes.begin(), bytes.end()).c_str();
+  }
+  void get(librevenge::RVNGBinaryData &data)
+  {
+    std::vector<unsigned char> bytes;
+    get(bytes);
+    data.clear();
+    if (!bytes.empty())
+      data.append(bytes.data(), bytes.size());
+  }
+
+  template <typename T> void get(boost::optional<T> &value)
+  {
+    bool present = false;
+    get(present);
+    value = boost::none;
+    if (present)
+    {
+      T v = blank<T>();
+      get(v);
+      value = v;
+    }
+  }
+  template <typename A, typename B> void get(std::pair<A, B> &value)
+  {
+    get(value.first);
+    get(value.second);
+  }
+  template <typename T> void get(std::vector<T> &values)
+  {
+    const unsigned count = getCount();
+    values.clear();
+    values.reserve(count);
+    for (unsigned i = 0; i < count; ++i)
+    {
+      T value = blank<T>();
+      get(value);
+      values.push_back(value);
+    }
+  }
+  template <typename T> void get(std::list<T> &values)
+  {
+    const unsigned count = getCount();
+    values.clear();
+    for (unsigned i = 0; i < count; ++i)
+    {
+      T value = blank<T>();
+      get(value);
+      values.push_back(value);
+    }
+  }
+  template <typename T> void get(std::set<T> &values)
+  {
+    const unsigned count = getCount();
+    values.clear();
+    for (unsigned i = 0; i < count; ++i)
+    {
+      T value = blank<T>();
+      get(value);
+      values.insert(value);
+    }
+  }
+  template <typename K, typename V> void get(std::map<K, V> &values)
+  {
+    const unsigned count = getCount();
+    values.clear();
+    for (unsigned i = 0; i < count; ++i)
+    {
+      std::pair<K, V> value(blank<K>(), blank<V>());
+      get(value);
+      values.insert(value);
+    }
+  }
+  template <typename V> void get(SeqNumMap<V> &values)
+  {
+    const unsigned count = getCount();
+    values.clear();
+    for (unsigned i = 0; i < count; ++i)
+    {
+      std::pair<unsigned, V> value(0, blank<V>());
+      get(value);
+      values.insert(value);
+    }
+  }
+
+  void get(Color &color)
+  {
+    get(color.r);
+    get(color.g);
+    get(color.b);
+  }
+  void get(ColorReference &color)
+  {
+    unsigned baseColor = 0;
+    unsigned modifiedColor = 0;
+    get(baseColor);
+    get(modifiedColor);
+    color = ColorReference(baseColor, modifiedColor);
+  }
+  void get(CharacterStyle &style)
+  {
+    get(style.underline);
+    get(style.italic);
+    get(style.bold);
+    get(style.textSizeInPt);
+    get(style.colorIndex);
+    get(style.fontIndex);
+    get(style.superSubType);
+    get(style.outline);
+    get(style.shadow);
+    get(style.smallCaps);
+    get(style.allCaps);
+    get(style.emboss);
+    get(style.engrave);
+    get(style.textScale);
+    get(style.lcid);
+  }
+  void get(LineSpacingInfo &spacing)
+  {
+    get(spacing.m_type);
+    get(spacing.m_amount);
+  }
+  void get(ListInfo &list)
+  {
+    get(list.m_listType);
+    get(list.m_bulletChar);
+    get(list.m_numberIfRestarted);
+    get(list.m_numberingType);
+    get(list.m_numberingDelimiter);
+  }
+  void get(ParagraphStyle &style)
+  {
+    get(style.m_align);
+    get(style.m_defaultCharStyleIndex);
+    get(style.m_lineSpacing);
+    get(style.m_spaceBeforeEmu);
+    get(style.m_spaceAfterEmu);
+    get(style.m_firstLineIndentEmu);
+    get(style.m_leftIndentEmu);
+    get(style.m_rightIndentEmu);
+    get(style.m_listInfo);
+    get(style.m_tabStopsInEmu);
+    get(style.m_dropCapLines);
+    get(style.m_dropCapLetters);
+  }
+  void get(TextSpan &span)
+  {
+    get(span.chars);
+    get(span.style);
+  }
+  void get(TextParagraph &paragraph)
+  {
+    get(paragraph.spans);
+    get(paragraph.style);
+  }
+  void get(Dot &dot)
+  {
+    get(dot.m_length);
+    get(dot.m_count);
+  }
+  void get(Dash &dash)
+  {
+    get(dash.m_distance);
+    get(dash.m_dotStyle);
+    get(dash.m_dots);
+  }
+  void get(Line &line)
+  {
+    get(line.m_color);
+    get(line.m_widthInEmu);
+    get(line.m_lineExists);
+    get(line.m_dash);
+  }
+  void get(Arrow &arrow)
+  {
+    get(arrow.m_style);
+    get(arrow.m_width);
+    get(arrow.m_height);
+  }
+  void get(Shadow &shadow)
+  {
+    get(shadow.m_type);
+    get(shadow.m_offsetXInEmu);
+    get(shadow.m_offsetYInEmu);
+    get(shadow.m_SecondOffsetXInEmu);
+    get(shadow.m_SecondOffsetYInEmu);
+    get(shadow.m_originXInEmu);
+    get(shadow.m_originYInEmu);
+    get(shadow.m_opacity);
+    get(shadow.m_color);
+    get(shadow.m_highColor);
+  }
+  void get(Margins &margins)
+  {
+    get(margins.m_left);
+    get(margins.m_top);
+    get(margins.m_right);
+    get(margins.m_bottom);
+  }
+  void get(Coordinate &coord)
+  {
+    get(coord.m_xs);
+    get(coord.m_ys);
+    get(coord.m_xe);
+    get(coord.m_ye);
+  }
+  void get(CellInfo &cell)
+  {
+    get(cell.m_startRow);
+    get(cell.m_endRow);
+    get(cell.m_startColumn);
+    get(cell.m_endColumn);
+  }
+  void get(TableInfo &table)
+  {
+    get(table.m_rowHeightsInEmu);
+    get(table.m_columnWidthsInEmu);
+    get(table.m_numRows);
+    get(table.m_numColumns);
+    get(table.m_cells);
+  }
+  void get(Vertex &vertex)
+  {
+    get(vertex.m_x);
+    get(vertex.m_y);
+  }
+  void get(Calculation &calc)
+  {
+    get(calc.m_flags);
+    get(calc.m_argOne);
+    get(calc.m_argTwo);
+    get(calc.m_argThree);
+  }
+  void get(TextRectangle &rect)
+  {
+    get(rect.first);
+    get(rect.second);
+  }
+  void get(DynamicCustomShape &shape)
+  {
+    get(shape.m_vertices);
+    get(shape.m_elements);
+    get(shape.m_calculations);
+    get(shape.m_defaultAdjustValues);
+    get(shape.m_textRectangles);
+    get(shape.m_gluePoints);
+    get(shape.m_coordWidth);
+    get(shape.m_coordHeight);
+    get(shape.m_adjustShiftMask);
+  }
+  void get(std::shared_ptr<const Fill> &fill)
+  {
+    switch (m_span.readU8())
+    {
+    case NO_FILL:
+      fill.reset();
+      break;
+    case PATTERN_FILL:
+    {
+      unsigned imgIndex = 0;
+      ColorReference fg(0);
+      ColorReference bg(0);
+      get(imgIndex);
+      get(fg);
+      get(bg);
+      fill.reset(new PatternFill(imgIndex, fg, bg));
+      break;
+    }
+    case IMG_FILL:
+    {
+      unsigned imgIndex = 0;
+      bool isTexture = false;
+      int rotation = 0;
+      get(imgIndex);
+      get(isTexture);
+      get(rotation);
+      fill.reset(new ImgFill(imgIndex, isTexture, rotation));
+      break;
+    }
+    case SOLID_FILL:
+    {
+      ColorReference color(0);
+      double opacity = 1;
+      get(color);
+      get(opacity);
+      fill.reset(new SolidFill(color, opacity));
+      break;
+    }
+    case GRADIENT_FILL:
+    {
+      double angle = 0;
+      int type = 0;
+      get(angle);
+      get(type);
+      std::shared_ptr<GradientFill> gradient(new GradientFill(angle, type));
+      double left = 0;
+      double top = 0;
+      double right = 0;
+      double bottom = 0;
+      get(left);
+      get(top);
+      get(right);
+      get(bottom);
+      gradient->setFillCenter(left, top, right, bottom);
+      const unsigned count = getCount();
+      for (unsigned i = 0; i < count; ++i)
+      {
+        ColorReference color(0);
+        unsigned offsetPercent = 0;
+        double opacity = 1;
+        get(color);
+        get(offsetPercent);
+        get(opacity);
+        gradient->addColor(color, offsetPercent, opacity);
+      }
+      fill = gradient;
+      break;
+    }
+    default:
+      throw GenericException();
+    }
+  }
+  void get(ShapeInfo &info)
+  {
+    get(info.m_type);
+    get(info.m_imgIndex);
+    get(info.m_coordinates);
+    get(info.m_lines);
+    get(info.m_pageSeqNum);
+    get(info.m_textId);
+    get(info.m_rotation);
+    get(info.m_flips);
+    get(info.m_margins);
+    get(info.m_fill);
+    get(info.m_innerRotation);
+    bool hasExtra = false;
+    get(hasExtra);
+    if (hasExtra)
+      get(info.getOrCreateExtra());
+  }
+  void get(ShapeExtraInfo &extra)
+  {
+    get(extra.m_cropType);
+    get(extra.m_borderImgIndex);
+    get(extra.m_adjustValuesByIndex);
+    get(extra.m_adjustValues);
+    get(extra.m_borderPosition);
+    get(extra.m_customShape);
+    get(extra.m_stretchBorderArt);
+    get(extra.m_lineBackColor);
+    get(extra.m_dash);
+    get(extra.m_tableInfo);
+    get(extra.m_numColumns);
+    get(extra.m_columnSpacing);
+    get(extra.m_beginArrow);
+    get(extra.m_endArrow);
+    get(extra.m_verticalAlign);
+    get(extra.m_pictureRecolor);
+    get(extra.m_shadow);
+    get(extra.m_clipPath);
+    get(extra.m_pictureBrightness);
+    get(extra.m_pictureContrast);
+  }
+  void get(ImgInfo &img)
+  {
+    ImgType type = UNKNOWN;
+    bool isDelayed = false;
+    get(type);
+    get(isDelayed);
+    if (isDelayed)
+    {
+      const MSPUBMemoryStream *const delayStream = m_context.getSubStream("Escher/EscherDelayStm");
+      if (!delayStream)
+        throw GenericException();
+      const unsigned long offset = m_span.readU64();
+      const unsigned long length = m_span.readU64();
+      const unsigned long sizeHint = m_span.readU64();
+      img = ImgInfo(type, delayStream, offset, length, sizeHint);
+    }
+    else
+    {
+      librevenge::RVNGBinaryData data;
+      get(data);
+      img = ImgInfo(type, data);
+    }
+  }
+  void get(BorderImgInfo &img)
+  {
+    get(img.m_type);
+    get(img.m_imgBlob);
+  }
+  void get(BorderArtInfo &art)
+  {
+    get(art.m_images);
+    get(art.m_offsets);
+    get(art.m_offsetsOrdered);
+  }
+  void get(EmbeddedFontInfo &font)
+  {
+    get(font.m_name);
+    get(font.m_blob);
+  }
+
+  void getShapeGroup(const std::shared_ptr<ShapeGroupElement> &parent, std::vector<std::shared_ptr<ShapeGroupElement> > &topLevelShapes)
+  {
+    unsigned seqNum = 0;
+    get(seqNum);
+    const auto elt = ShapeGroupElement::create(parent, seqNum);
+    if (!parent)
+      topLevelShapes.push_back(elt);
+    m_elements.push_back(elt);
+    const unsigned count = getCount();
+    for (unsigned i = 0; i < count; ++i)
+      getShapeGroup(elt, topLevelShapes);
+  }
+
+  void getModel(MSPUBDocumentModel &model)
+  {
+    get(model.m_width);
+    get(model.m_height);
+    get(model.m_widthSet);
+    get(model.m_heightSet);
+    get(model.m_textStringsById);
+    std::vector<unsigned> pageSeqNums;
+    get(pageSeqNums);
+    for (const auto seqNum : pageSeqNums)
+      model.m_pagesBySeqNum[seqNum] = MSPUBDocumentModel::PageInfo();
+    get(model.m_images);
+    get(model.m_borderImages);
+    get(model.m_textColors);
+    get(model.m_fonts);
+    get(model.m_defaultCharStyles);
+    get(model.m_defaultParaStyles);
+    get(model.m_shapeTypesBySeqNum);
+    get(model.m_paletteColors);
+    get(model.m_shapeSeqNumsOrdered);
+    get(model.m_pageSeqNumsByShapeSeqNum);
+    get(model.m_bgShapeSeqNumsByPageSeqNum);
+    get(model.m_skipIfNotBgSeqNums);
+    const unsigned topLevelCount = getCount();
+    for (unsigned i = 0; i < topLevelCount; ++i)
+      getShapeGroup(std::shared_ptr<ShapeGroupElement>(), model.m_topLevelShapes);
+    const unsigned groupCount = getCount();
+    for (unsigned i = 0; i < groupCount; ++i)
+    {
+      unsigned seqNum = 0;
+      unsigned index = 0;
+      get(seqNum);
+      get(index);
+      if (index >= m_elements.size())
+        throw GenericException();
+      model.m_groupsBySeqNum[seqNum] = m_elements[index];
+    }
+    get(model.m_embeddedFonts);
+    get(model.m_shapeInfosBySeqNum);
+    get(model.m_masterPages);
+    get(model.m_shapesWithCoordinatesRotated90);
+    get(model.m_masterPagesByPageSeqNum);
+    get(model.m_tableCellTextEndsByTextId);
+    get(model.m_stringOffsetsByTextId);
+    get(model.m_pageSeqNumsOrdered);
+    get(model.m_encodingHeuristic);
+    get(model.m_allText);
+    std::vector<std::pair<librevenge::RVNGString, librevenge::RVNGString> > metaData;
+    get(metaData);
+    for (const auto &entry : metaData)
+      model.m_metaData.insert(entry.first.cstr(), entry.second);
+  }
+
+private:
+  SpanReader m_span;
+  MSPUBDocumentContext &m_context;
+  MSPUBCollector &m_collector;
+  std::vector<std::shared_ptr<ShapeGroupElement> > m_elements;
+};
+
+MSPUBParseCache::MSPUBParseCache(MSPUBDocumentContext &context)
+  : m_context(context), m_path(), m_contentDigest()
+{
+  const char *const dir = std::getenv("LIBMSPUB_CACHE_DIR");
+  if (dir && *dir && hashContent())
+    m_path = std::string(dir) + '/' + SHA256::toHex(m_contentDigest) + ".pubcache";
+}
+
+bool MSPUBParseCache::hashContent()
+{
+  librevenge::RVNGInputStream *const input = m_context.getInput();
+  SHA256 sha;
+  unsigned long length = 0;
+  try
+  {
+    input->seek(0, librevenge::RVNG_SEEK_SET);
+    while (!input->isEnd())
+    {
+      unsigned long numBytesRead = 0;
+      const unsigned char *const data = input->read(HASH_CHUNK_SIZE, numBytesRead);
+      if (!data || numBytesRead == 0)
+        break;
+      sha.update(data, numBytesRead);
+      length += numBytesRead;
+    }
+    input->seek(0, librevenge::RVNG_SEEK_SET);
+  }
+  catch (...)
+  {
+    return false;
+  }
+  m_contentDigest = sha.finish();
+  return length != 0;
+}
+
+bool MSPUBParseCache::load(MSPUBCollector &collector)
+{
+  if (m_path.empty())
+    return false;
+  std::ifstream file(m_path.c_str(), std::ios::in | std::ios::binary);
+  if (!file)
+    return false;
+  const std::vector<unsigned char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  try
+  {
+    SpanReader header(contents.data(), contents.size());
+    if (header.readU32() != CACHE_MAGIC || header.readU32() != CACHE_FORMAT_VERSION)
+      return false;
+    if (header.remaining() < m_contentDigest.size()
+        || std::memcmp(header.current(), m_contentDigest.data(), m_contentDigest.size()) != 0)
+      return false;
+    header.skip(m_contentDigest.size());
+    const uint64_t payloadLength = header.readU64();
+    const uint64_t payloadHash = header.readU64();
+    if (payloadLength != header.remaining())
+      return false;
+    const unsigned char *const payload = contents.data() + header.tell();
+    if (fnv1a(FNV_OFFSET_BASIS, payload, payloadLength) != payloadHash)
+      return false;
+    Reader reader(payload, payloadLength, m_context, collector);
+    reader.getModel(collector.getModel());
+    return reader.isEnd();
+  }
+  catch (...)
+  {
+    MSPUB_DEBUG_MSG(("Invalid parse cache entry %s\n", m_path.c_str()));
+    return false;
+  }
+}
+
+void MSPUBParseCache::store(const MSPUBCollector &collector)
+{
+  if (m_path.empty())
+    return;
+  try
+  {
+    Writer payload;
+    payload.putModel(collector.getModel());
+    const std::vector<unsigned char> &payloadBuffer = payload.getBuffer();
+    Writer header;
+    header.putU32(CACHE_MAGIC);
+    header.putU32(CACHE_FORMAT_VERSION);
+    header.putBytes(m_contentDigest.data(), m_contentDigest.size());
+    header.putU64(payloadBuffer.size());
+    header.putU64(fnv1a(FNV_OFFSET_BASIS, payloadBuffer.data(), payloadBuffer.size()));
+
+    // write to a temporary file first, so that no reader sees a partial entry
+    const std::string tmpPath = getTempPath(m_path);
+    bool written = false;
+    {
+      std::ofstream file(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<const char *>(header.getBuffer().data()), header.getBuffer().size());
+      file.write(reinterpret_cast<const char *>(payloadBuffer.data()), payloadBuffer.size());
+      file.close();
+      written = bool(file);
+    }
+    if (!written || !replaceFile(tmpPath, m_path))
+    {
+      MSPUB_DEBUG_MSG(("Couldn't write parse cache entry %s\n", m_path.c_str()));
+      std::remove(tmpPath.c_str());
+    }
+  }
+  catch (...)
+  {
+    MSPUB_DEBUG_MSG(("Couldn't serialize the document model\n"));
+  }
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
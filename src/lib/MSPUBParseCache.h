@@ -0,0 +1,58 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MSPUBPARSECACHE_H
+#define INCLUDED_MSPUBPARSECACHE_H
+
+#include <string>
+
+#include "SHA256.h"
+
+namespace libmspub
+{
+
+class MSPUBCollector;
+class MSPUBDocumentContext;
+
+/* Keeps the document model the parsers built on disk, keyed by the SHA-256
+ * of the document's content, so that parsing the same document again
+ * skips the parsers. It is only used if the environment variable
+ * LIBMSPUB_CACHE_DIR names a directory. Entries written by another format
+ * version, or that fail validation, are ignored and replaced.
+ */
+class MSPUBParseCache
+{
+public:
+  explicit MSPUBParseCache(MSPUBDocumentContext &context);
+
+  // Fills the model of a new collector from the cache. On a miss, returns
+  // false; the collector may then be partly filled and must be discarded.
+  // Like the parsers, it leaves the geometry of the shapes to go().
+  bool load(MSPUBCollector &collector);
+  // Saves the model of collector as the parsers left it, i.e., before go().
+  void store(const MSPUBCollector &collector);
+
+private:
+  MSPUBParseCache(const MSPUBParseCache &);
+  MSPUBParseCache &operator=(const MSPUBParseCache &);
+
+  class Writer;
+  class Reader;
+
+  bool hashContent();
+
+  MSPUBDocumentContext &m_context;
+  std::string m_path;
+  SHA256::Digest m_contentDigest;
+};
+
+}
+
+#endif // INCLUDED_MSPUBPARSECACHE_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
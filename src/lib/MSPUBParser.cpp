@@ -32,6 +32,7 @@
 #include "FillType.h"
 #include "Line.h"
 #include "ListInfo.h"
+#include "MSPUBBlockDescriptor.h"
 #include "MSPUBBlockID.h"
 #include "MSPUBBlockType.h"
 #include "MSPUBCollector.h"
@@ -43,6 +44,7 @@
 #include "ShapeType.h"
 #include "TableInfo.h"
 #include "VerticalAlign.h"
+#include "WorkerPool.h"
 #include "libmspub_utils.h"
 
 namespace libmspub
@@ -51,6 +53,10 @@ namespace libmspub
 namespace
 {
 
+// decoding a shape chunk takes a few microseconds, so smaller batches are
+// not worth a thread
+const unsigned long SHAPE_CHUNKS_PER_THREAD = 256;
+
 Underline readUnderline(const unsigned value)
 {
   switch (value & 0xff)
@@ -99,18 +105,21 @@ Underline readUnderline(const unsigned value)
 
 }
 
-MSPUBParser::MSPUBParser(librevenge::RVNGInputStream *input, MSPUBCollector *collector)
-  : m_input(input),
-    m_length(boost::numeric_cast<unsigned>(getLength(input))),
+MSPUBParser::MSPUBParser(MSPUBDocumentContext *context, MSPUBCollector *collector)
+  : m_context(context),
+    m_input(context->getInput()),
+    m_length(boost::numeric_cast<unsigned>(context->getLength())),
     m_collector(collector),
-    m_blockInfo(), m_contentChunks(),
+    m_contentChunks(),
     m_cellsChunkIndices(),
     m_pageChunkIndices(), m_shapeChunkIndices(),
     m_paletteChunkIndices(), m_borderArtChunkIndices(),
     m_fontChunkIndices(),
     m_unknownChunkIndices(), m_documentChunkIndex(),
+    m_chunkIndicesBySeqNum(), m_chunkChildIndicesBySeqNum(),
     m_lastSeenSeqNum(-1), m_lastAddedImage(0),
-    m_alternateShapeSeqNums(), m_escherDelayIndices()
+    m_alternateShapeSeqNums(), m_escherDelayIndices(),
+    m_selectedSeqNums()
 {
 }
 
@@ -118,8 +127,8 @@ MSPUBParser::~MSPUBParser()
 {
 }
 
-bool MSPUBParser::lineExistsByFlagPointer(unsigned *flags,
-                                          unsigned *geomFlags)
+bool MSPUBParser::lineExistsByFlagPointer(const unsigned *flags,
+                                          const unsigned *geomFlags)
 {
   return flags &&
          !(((*flags) & FLAG_USE_LINE) && !((*flags) & FLAG_LINE)) &&
@@ -133,49 +142,6 @@ unsigned MSPUBParser::getColorIndexByQuillEntry(unsigned entry)
   return entry;
 }
 
-short MSPUBParser::getBlockDataLength(unsigned type) // -1 for variable-length block with the data length as the first DWORD
-{
-  switch (type)
-  {
-  case DUMMY:
-  case 0x5:
-  case 0x8:
-  case 0xa:
-    return 0;
-  case 0x10:
-  case 0x12:
-  case 0x18:
-  case 0x1a:
-  case 0x07:
-    return 2;
-  case 0x20:
-  case 0x22:
-  case 0x58:
-  case 0x68:
-  case 0x70:
-  case 0xb8:
-    return 4;
-  case 0x28:
-    return 8;
-  case 0x38:
-    return 16;
-  case 0x48:
-    return 24;
-  case STRING_CONTAINER:
-  case 0x80:
-  case 0x82:
-  case GENERAL_CONTAINER:
-  case 0x8a:
-  case 0x90:
-  case 0x98:
-  case 0xa0:
-    return -1;
-  }
-  //FIXME: Debug assertion here? Should never get here.
-  MSPUB_DEBUG_MSG(("Block of unknown type seen!\n"));
-  return 0;
-}
-
 bool MSPUBParser::parse()
 {
   MSPUB_DEBUG_MSG(("***NOTE***: Where applicable, the meanings of block/chunk IDs and Types printed below may be found in:\n\t***MSPUBBlockType.h\n\t***MSPUBBlockID.h\n\t***MSPUBContentChunkType.h\n*****\n"));
@@ -183,46 +149,71 @@ bool MSPUBParser::parse()
     return false;
   // No check: metadata are not important enough to fail if they can't be parsed
   parseMetaData();
-  std::unique_ptr<librevenge::RVNGInputStream> quill(m_input->getSubStreamByName("Quill/QuillSub/CONTENTS"));
+  // all substreams are read here: the input stream is not thread-safe
+  MSPUBMemoryStream *const quill = m_context->getSubStream("Quill/QuillSub/CONTENTS");
   if (!quill)
   {
     MSPUB_DEBUG_MSG(("Couldn't get quill stream.\n"));
     return false;
   }
-  if (!parseQuill(quill.get()))
-  {
-    MSPUB_DEBUG_MSG(("Couldn't parse quill stream.\n"));
-    return false;
-  }
-  std::unique_ptr<librevenge::RVNGInputStream> contents(m_input->getSubStreamByName("Contents"));
+  MSPUBMemoryStream *const contents = m_context->getSubStream("Contents");
   if (!contents)
   {
     MSPUB_DEBUG_MSG(("Couldn't get contents stream.\n"));
     return false;
   }
-  if (!parseContents(contents.get()))
+  MSPUBMemoryStream *const escherDelay = m_context->getSubStream("Escher/EscherDelayStm");
+  MSPUBMemoryStream *const escher = m_context->getSubStream("Escher/EscherStm");
+  if (!escher)
   {
-    MSPUB_DEBUG_MSG(("Couldn't parse contents stream.\n"));
+    MSPUB_DEBUG_MSG(("Couldn't get escher stream.\n"));
     return false;
   }
-  std::unique_ptr<librevenge::RVNGInputStream> escherDelay(m_input->getSubStreamByName("Escher/EscherDelayStm"));
+
+  // Quill and EscherDelayStm depend on nothing else, so they are parsed
+  // alongside Contents and EscherStm and merged into the collector at the
+  // end. If anything below throws, the tasks are waited for if they have
+  // been started and dropped if not.
+  ParsedQuill parsedQuill;
+  bool quillOk = false;
+  ConcurrentTask quillParsed([this, quill, &parsedQuill, &quillOk]()
+  {
+    quillOk = parseQuill(quill, parsedQuill);
+  });
+  std::vector<ImgInfo> images;
+  std::unique_ptr<ConcurrentTask> escherDelayParsed;
   if (escherDelay)
   {
-    parseEscherDelay(escherDelay.get());
+    escherDelayParsed.reset(new ConcurrentTask([this, escherDelay, &images]()
+    {
+      parseEscherDelay(escherDelay, images);
+    }));
   }
-  std::unique_ptr<librevenge::RVNGInputStream> escher(m_input->getSubStreamByName("Escher/EscherStm"));
-  if (!escher)
+
+  if (!parseContents(contents))
   {
-    MSPUB_DEBUG_MSG(("Couldn't get escher stream.\n"));
+    MSPUB_DEBUG_MSG(("Couldn't parse contents stream.\n"));
     return false;
   }
-  if (!parseEscher(escher.get()))
+  if (!parseEscher(escher))
   {
     MSPUB_DEBUG_MSG(("Couldn't parse escher stream.\n"));
     return false;
   }
+  quillParsed.wait();
+  if (!quillOk)
+  {
+    MSPUB_DEBUG_MSG(("Couldn't parse quill stream.\n"));
+    return false;
+  }
+  applyQuill(parsedQuill);
+  if (escherDelayParsed)
+  {
+    escherDelayParsed->wait();
+    applyEscherDelay(images);
+  }
 
-  return m_collector->go();
+  return true;
 }
 
 ImgType MSPUBParser::imgTypeByBlipType(unsigned short type)
@@ -290,7 +281,17 @@ int MSPUBParser::getStartOffset(ImgType type, unsigned short initial)
   return offset + (oneUid ? 0 : 0x10);
 }
 
-bool MSPUBParser::parseEscherDelay(librevenge::RVNGInputStream *input)
+void MSPUBParser::applyEscherDelay(const std::vector<ImgInfo> &images)
+{
+  for (const auto &img : images)
+  {
+    ++m_lastAddedImage;
+    if (img.getType() != UNKNOWN)
+      m_collector->addImage(m_lastAddedImage, img);
+  }
+}
+
+void MSPUBParser::parseEscherDelay(MSPUBMemoryStream *input, std::vector<ImgInfo> &images)
 {
   while (stillReading(input, (unsigned long)-1))
   {
@@ -298,79 +299,38 @@ bool MSPUBParser::parseEscherDelay(librevenge::RVNGInputStream *input)
     const ImgType imgType = imgTypeByBlipType(info.type);
     if (imgType != UNKNOWN)
     {
-      librevenge::RVNGBinaryData img;
-      unsigned long toRead = info.contentsLength;
-      input->seek(input->tell() + getStartOffset(imgType, info.initial), librevenge::RVNG_SEEK_SET);
-      while (toRead > 0 && stillReading(input, (unsigned long)-1))
-      {
-        unsigned long howManyRead = 0;
-        const unsigned char *buf = input->read(toRead, howManyRead);
-        img.append(buf, howManyRead);
-        toRead -= howManyRead;
-      }
+      const unsigned long startOffset = info.contentsOffset + getStartOffset(imgType, info.initial);
+      unsigned long uncompressedSize = 0;
       if (imgType == WMF || imgType == EMF)
       {
-        img = inflateData(img);
+        // cbSize of the OfficeArtMetafileHeader, which is followed by
+        // 0x1E more bytes of header and the 2-byte zlib header
+        input->seek(startOffset - 0x24, librevenge::RVNG_SEEK_SET);
+        SpanReader metafileHeader = readSpan(input, 4);
+        if (metafileHeader.remaining() == 4)
+          uncompressedSize = metafileHeader.readU32();
       }
-      else if (imgType == DIB)
+      const unsigned long available = startOffset < input->size() ? input->size() - startOffset : 0;
+      if (imgType == DIB && std::min(available, info.contentsLength) < 0x2E + 4)
       {
-        // Reconstruct BMP header
-        // cf. http://en.wikipedia.org/wiki/BMP_file_format , accessed 2012-5-31
-        librevenge::RVNGInputStream *buf = img.getDataStream();
-        if (img.size() < 0x2E + 4)
-        {
-          ++m_lastAddedImage;
-          MSPUB_DEBUG_MSG(("Garbage DIB at index 0x%x\n", m_lastAddedImage));
-          input->seek(info.contentsOffset + info.contentsLength, librevenge::RVNG_SEEK_SET);
-          continue;
-        }
-        buf->seek(0x0E, librevenge::RVNG_SEEK_SET);
-        unsigned short bitsPerPixel = readU16(buf);
-        buf->seek(0x20, librevenge::RVNG_SEEK_SET);
-        unsigned numPaletteColors = readU32(buf);
-        if (numPaletteColors == 0 && bitsPerPixel <= 8)
-        {
-          numPaletteColors = 1;
-          for (int i = 0; i < bitsPerPixel; ++i)
-          {
-            numPaletteColors *= 2;
-          }
-        }
-
-        librevenge::RVNGBinaryData tmpImg;
-        tmpImg.append((unsigned char)0x42);
-        tmpImg.append((unsigned char)0x4d);
-
-        tmpImg.append((unsigned char)((img.size() + 14) & 0x000000ff));
-        tmpImg.append((unsigned char)(((img.size() + 14) & 0x0000ff00) >> 8));
-        tmpImg.append((unsigned char)(((img.size() + 14) & 0x00ff0000) >> 16));
-        tmpImg.append((unsigned char)(((img.size() + 14) & 0xff000000) >> 24));
-
-        tmpImg.append((unsigned char)0x00);
-        tmpImg.append((unsigned char)0x00);
-        tmpImg.append((unsigned char)0x00);
-        tmpImg.append((unsigned char)0x00);
-
-        tmpImg.append((unsigned char)(0x36 + 4 * numPaletteColors));
-        tmpImg.append((unsigned char)0x00);
-        tmpImg.append((unsigned char)0x00);
-        tmpImg.append((unsigned char)0x00);
-        tmpImg.append(img);
-        img = tmpImg;
+        images.push_back(ImgInfo());
+        MSPUB_DEBUG_MSG(("Garbage DIB at index 0x%x\n", unsigned(images.size())));
+        input->seek(info.contentsOffset + info.contentsLength, librevenge::RVNG_SEEK_SET);
+        continue;
       }
-      m_collector->addImage(++m_lastAddedImage, imgType, img);
+      // only record where the blip is; it is decoded if a shape uses it
+      images.push_back(ImgInfo(imgType, input, startOffset, info.contentsLength, uncompressedSize));
     }
     else
     {
-      ++m_lastAddedImage;
-      MSPUB_DEBUG_MSG(("Image of unknown type at index 0x%x\n", m_lastAddedImage));
+      images.push_back(ImgInfo());
+      MSPUB_DEBUG_MSG(("Image of unknown type at index 0x%x\n", unsigned(images.size())));
     }
     input->seek(info.contentsOffset + info.contentsLength, librevenge::RVNG_SEEK_SET);
   }
-  return true;
 }
 
-bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
+bool MSPUBParser::parseContents(MSPUBMemoryStream *input)
 {
   MSPUB_DEBUG_MSG(("MSPUBParser::parseContents\n"));
   input->seek(0x1a, librevenge::RVNG_SEEK_SET);
@@ -387,11 +347,12 @@ bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
 
       while (stillReading(input, trailerPart.dataOffset + trailerPart.dataLength))
       {
-        m_blockInfo.push_back(parseBlock(input));
+        // only the chunk references are needed, so nothing else is read
+        const MSPUBBlockInfo block = parseBlockHeader(input);
         ++m_lastSeenSeqNum;
-        if (m_blockInfo.back().type == GENERAL_CONTAINER)
+        if (block.type == GENERAL_CONTAINER)
         {
-          if (parseContentChunkReference(input, m_blockInfo.back()))
+          if (parseContentChunkReference(input, block))
           {
             if (m_contentChunks.size() > 1)
             {
@@ -399,7 +360,8 @@ bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
             }
           }
         }
-        else(skipBlock(input, m_blockInfo.back()));
+        else
+          skipBlock(input, block);
       }
       if (!m_contentChunks.empty())
       {
@@ -429,16 +391,6 @@ bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
           return false;
         }
       }
-      for (unsigned int shapeChunkIndex : m_shapeChunkIndices)
-      {
-        const ContentChunkReference &shapeChunk =
-          m_contentChunks.at(shapeChunkIndex);
-        input->seek(shapeChunk.offset, librevenge::RVNG_SEEK_SET);
-        if (!parseShape(input, shapeChunk))
-        {
-          return false;
-        }
-      }
       for (unsigned int fontChunkIndex : m_fontChunkIndices)
       {
         const ContentChunkReference &fontChunk =
@@ -449,6 +401,8 @@ bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
           return false;
         }
       }
+      // pages come before shapes, so that only the shapes of the selected
+      // pages need to be parsed
       input->seek(documentChunk.offset, librevenge::RVNG_SEEK_SET);
       if (!parseDocumentChunk(input, documentChunk))
       {
@@ -463,6 +417,14 @@ bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
           return false;
         }
       }
+      if (m_collector->hasPageRange())
+      {
+        m_selectedSeqNums = m_collector->getSelectedSeqNums();
+      }
+      if (!parseShapeChunks(input))
+      {
+        return false;
+      }
     }
   }
   input->seek(trailerOffset + trailerLength, librevenge::RVNG_SEEK_SET);
@@ -471,9 +433,9 @@ bool MSPUBParser::parseContents(librevenge::RVNGInputStream *input)
 }
 
 #ifdef DEBUG
-bool MSPUBParser::parseDocumentChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk)
+bool MSPUBParser::parseDocumentChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk)
 #else
-bool MSPUBParser::parseDocumentChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &)
+bool MSPUBParser::parseDocumentChunk(MSPUBMemoryStream *input, const ContentChunkReference &)
 #endif
 {
   MSPUB_DEBUG_MSG(("parseDocumentChunk: offset 0x%lx, end 0x%lx\n", input->tell(), chunk.end));
@@ -518,7 +480,7 @@ bool MSPUBParser::parseDocumentChunk(librevenge::RVNGInputStream *input, const C
 }
 
 bool MSPUBParser::parseFontChunk(
-  librevenge::RVNGInputStream *input, const ContentChunkReference &chunk)
+  MSPUBMemoryStream *input, const ContentChunkReference &chunk)
 {
   unsigned length = readU32(input);
   while (stillReading(input, chunk.offset + length))
@@ -583,7 +545,7 @@ bool MSPUBParser::parseFontChunk(
 }
 
 bool MSPUBParser::parseBorderArtChunk(
-  librevenge::RVNGInputStream *input, const ContentChunkReference &chunk)
+  MSPUBMemoryStream *input, const ContentChunkReference &chunk)
 {
   unsigned length = readU32(input);
   while (stillReading(input, chunk.offset + length))
@@ -646,7 +608,7 @@ bool MSPUBParser::parseBorderArtChunk(
   return true;
 }
 
-bool MSPUBParser::parsePageChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk)
+bool MSPUBParser::parsePageChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk)
 {
   MSPUB_DEBUG_MSG(("parsePageChunk: offset 0x%lx, end 0x%lx, seqnum 0x%x, parent 0x%x\n", input->tell(), chunk.end, chunk.seqNum, chunk.parentSeqNum));
   unsigned long length = readU32(input);
@@ -688,7 +650,7 @@ bool MSPUBParser::parsePageChunk(librevenge::RVNGInputStream *input, const Conte
   return true;
 }
 
-bool MSPUBParser::parsePageShapeList(librevenge::RVNGInputStream *input, MSPUBBlockInfo info, unsigned pageSeqNum)
+bool MSPUBParser::parsePageShapeList(MSPUBMemoryStream *input, MSPUBBlockInfo info, unsigned pageSeqNum)
 {
   MSPUB_DEBUG_MSG(("parsePageShapeList: page seqnum 0x%x\n", pageSeqNum));
   while (stillReading(input, info.dataOffset + info.dataLength))
@@ -702,10 +664,10 @@ bool MSPUBParser::parsePageShapeList(librevenge::RVNGInputStream *input, MSPUBBl
   return true;
 }
 
-bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
-                             const ContentChunkReference &chunk)
+bool MSPUBParser::decodeShapeChunk(MSPUBMemoryStream *input,
+                                   const ContentChunkReference &chunk, ShapeChunkRecord &record)
 {
-  MSPUB_DEBUG_MSG(("parseShape: seqNum 0x%x\n", chunk.seqNum));
+  MSPUB_DEBUG_MSG(("decodeShapeChunk: seqNum 0x%x\n", chunk.seqNum));
   unsigned long pos = input->tell();
   unsigned length = readU32(input);
   bool isTable = chunk.type == TABLE;
@@ -775,21 +737,13 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
         MSPUB_DEBUG_MSG(("ERROR: Wrong number of rows or columns found in table definition.\n"));
         return false;
       }
-      boost::optional<unsigned> index;
-      for (size_t i = 0; i < m_cellsChunkIndices.size(); ++i)
-      {
-        if (m_contentChunks[m_cellsChunkIndices[i]].seqNum == csn)
-        {
-          index = i;
-          break;
-        }
-      }
+      const ContentChunkReference *const cellsChunk = findChunkBySeqNum(csn, CELLS);
 
       TableInfo ti(nr, nc);
       ti.m_rowHeightsInEmu = rowHeightsInEmu;
       ti.m_columnWidthsInEmu = columnWidthsInEmu;
 
-      if (!index)
+      if (!cellsChunk)
       {
         MSPUB_DEBUG_MSG(("WARNING: Couldn't find cells of seqnum %u corresponding to table of seqnum %u.\n",
                          csn, chunk.seqNum));
@@ -797,11 +751,10 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
       }
       else
       {
-        const ContentChunkReference &cellsChunk = m_contentChunks[m_cellsChunkIndices[get(index)]];
-        input->seek(cellsChunk.offset, librevenge::RVNG_SEEK_SET);
+        input->seek(cellsChunk->offset, librevenge::RVNG_SEEK_SET);
         const unsigned cellsLength = readU32(input);
         boost::optional<unsigned> cellCount;
-        while (stillReading(input, cellsChunk.offset + cellsLength))
+        while (stillReading(input, cellsChunk->offset + cellsLength))
         {
           MSPUBBlockInfo info = parseBlock(input, true);
           switch (info.id)
@@ -858,9 +811,8 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
         }
       }
 
-      m_collector->setShapeTableInfo(chunk.seqNum, ti);
-      if (bool(textId))
-        m_collector->addTextShape(get(textId), chunk.seqNum);
+      record.m_tableInfo = ti;
+      record.m_textId = textId;
       return true;
     }
     return false;
@@ -885,7 +837,7 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
       }
       else if (info.id == SHAPE_BORDER_IMAGE_ID)
       {
-        m_collector->setShapeBorderImageId(chunk.seqNum, info.data);
+        record.m_borderImageId = info.data;
       }
       else if (info.id == SHAPE_DONT_STRETCH_BA)
       {
@@ -898,19 +850,14 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
       }
       else if (info.id == SHAPE_VALIGN)
       {
-        m_collector->setShapeVerticalTextAlign(chunk.seqNum,
-                                               static_cast<VerticalAlign>(info.data));
+        record.m_verticalAlign = static_cast<VerticalAlign>(info.data);
       }
       else if (info.id == SHAPE_CROP && info.data != 0)
       {
-        m_collector->setShapeCropType(chunk.seqNum,
-                                      static_cast<ShapeType>(info.data));
+        record.m_cropType = static_cast<ShapeType>(info.data);
       }
     }
-    if (shouldStretchBorderArt)
-    {
-      m_collector->setShapeStretchBorderArt(chunk.seqNum);
-    }
+    record.m_stretchBorderArt = shouldStretchBorderArt;
     bool parseWithoutDimensions = true; //FIXME: Should we ever ignore if height and width not given?
     if (isGroup || (height > 0 && width > 0) || parseWithoutDimensions)
     {
@@ -918,7 +865,7 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
       {
         if (isText)
         {
-          m_collector->addTextShape(textId, chunk.seqNum);
+          record.m_textId = textId;
         }
       }
     }
@@ -930,7 +877,63 @@ bool MSPUBParser::parseShape(librevenge::RVNGInputStream *input,
   }
 }
 
-QuillChunkReference MSPUBParser::parseQuillChunkReference(librevenge::RVNGInputStream *input)
+void MSPUBParser::applyShapeChunk(const ContentChunkReference &chunk, const ShapeChunkRecord &record)
+{
+  if (bool(record.m_tableInfo))
+    m_collector->setShapeTableInfo(chunk.seqNum, get(record.m_tableInfo));
+  if (bool(record.m_borderImageId))
+    m_collector->setShapeBorderImageId(chunk.seqNum, get(record.m_borderImageId));
+  if (bool(record.m_verticalAlign))
+    m_collector->setShapeVerticalTextAlign(chunk.seqNum, get(record.m_verticalAlign));
+  if (bool(record.m_cropType))
+    m_collector->setShapeCropType(chunk.seqNum, get(record.m_cropType));
+  if (record.m_stretchBorderArt)
+    m_collector->setShapeStretchBorderArt(chunk.seqNum);
+  if (bool(record.m_textId))
+    m_collector->addTextShape(get(record.m_textId), chunk.seqNum);
+}
+
+bool MSPUBParser::parseShapeChunks(MSPUBMemoryStream *input)
+{
+  std::vector<unsigned> chunkIndices;
+  chunkIndices.reserve(m_shapeChunkIndices.size());
+  for (unsigned shapeChunkIndex : m_shapeChunkIndices)
+  {
+    if (isChunkSelected(m_contentChunks.at(shapeChunkIndex)))
+      chunkIndices.push_back(shapeChunkIndex);
+  }
+
+  std::vector<ShapeChunkRecord> records(chunkIndices.size());
+  parallelFor(records.size(), SHAPE_CHUNKS_PER_THREAD, [this, input, &chunkIndices, &records](unsigned long i)
+  {
+    const ContentChunkReference &shapeChunk = m_contentChunks.at(chunkIndices[i]);
+    ShapeChunkRecord &record = records[i];
+    try
+    {
+      const std::unique_ptr<MSPUBMemoryStream> shapeInput(input->clone());
+      shapeInput->seek(shapeChunk.offset, librevenge::RVNG_SEEK_SET);
+      record.m_isValid = decodeShapeChunk(shapeInput.get(), shapeChunk, record);
+    }
+    catch (...)
+    {
+      record.m_exception = std::current_exception();
+    }
+  });
+
+  // apply in chunk order, stopping at the first failure as a sequential
+  // parse would
+  for (unsigned long i = 0; i < records.size(); ++i)
+  {
+    if (records[i].m_exception)
+      std::rethrow_exception(records[i].m_exception);
+    if (!records[i].m_isValid)
+      return false;
+    applyShapeChunk(m_contentChunks.at(chunkIndices[i]), records[i]);
+  }
+  return true;
+}
+
+QuillChunkReference MSPUBParser::parseQuillChunkReference(MSPUBMemoryStream *input)
 {
   QuillChunkReference ret;
   readU16(input); //FIXME: Can we do something sensible if this is not 0x18 ?
@@ -956,7 +959,7 @@ QuillChunkReference MSPUBParser::parseQuillChunkReference(librevenge::RVNGInputS
 }
 
 std::vector<unsigned> MSPUBParser::parseTableCellDefinitions(
-  librevenge::RVNGInputStream *input, const QuillChunkReference &chunk)
+  MSPUBMemoryStream *input, const QuillChunkReference &chunk)
 {
   std::vector<unsigned> ret;
   unsigned numElements = readU32(input) + 1;
@@ -973,7 +976,41 @@ std::vector<unsigned> MSPUBParser::parseTableCellDefinitions(
   return ret;
 }
 
-bool MSPUBParser::parseQuill(librevenge::RVNGInputStream *input)
+bool MSPUBParser::parseQuill(MSPUBMemoryStream *input)
+{
+  ParsedQuill quill;
+  if (!parseQuill(input, quill))
+    return false;
+  applyQuill(quill);
+  return true;
+}
+
+void MSPUBParser::applyQuill(const ParsedQuill &quill)
+{
+  for (const auto &textColor : quill.m_textColors)
+    m_collector->addTextColor(textColor);
+  for (const auto &font : quill.m_fonts)
+    m_collector->addFont(font);
+  for (const auto &charStyle : quill.m_defaultCharStyles)
+    m_collector->addDefaultCharacterStyle(charStyle);
+  for (const auto &paraStyle : quill.m_defaultParaStyles)
+    m_collector->addDefaultParagraphStyle(paraStyle);
+  boost::optional<std::set<unsigned> > shapeTextIds;
+  if (m_collector->hasPageRange())
+    shapeTextIds = m_collector->getShapeTextIds();
+  for (const auto &text : quill.m_texts)
+  {
+    // with a page range, texts of shapes that were skipped are dropped
+    if (bool(shapeTextIds) && shapeTextIds->find(text.m_id) == shapeTextIds->end())
+      continue;
+    m_collector->addTextString(text.m_paragraphs, text.m_id);
+    m_collector->setTextStringOffset(text.m_id, text.m_offset);
+    if (bool(text.m_tableCellTextEnds))
+      m_collector->setTableCellTextEnds(text.m_id, get(text.m_tableCellTextEnds));
+  }
+}
+
+bool MSPUBParser::parseQuill(MSPUBMemoryStream *input, ParsedQuill &quill)
 {
   MSPUB_DEBUG_MSG(("MSPUBParser::parseQuill\n"));
   unsigned chunkReferenceListOffset = 0x18;
@@ -1047,7 +1084,7 @@ bool MSPUBParser::parseQuill(librevenge::RVNGInputStream *input)
     else if (i->name == "PL  ")
     {
       input->seek(i->offset, librevenge::RVNG_SEEK_SET);
-      parseColors(input, *i);
+      parseColors(input, *i, quill);
     }
     else if (i->name == "FDPC")
     {
@@ -1068,14 +1105,14 @@ bool MSPUBParser::parseQuill(librevenge::RVNGInputStream *input)
       if (whichStsh++ == 1)
       {
         input->seek(i->offset, librevenge::RVNG_SEEK_SET);
-        parseDefaultStyle(input, *i);
+        parseDefaultStyle(input, *i, quill);
         parsedStsh = true;
       }
     }
     else if (i->name == "FONT")
     {
       input->seek(i->offset, librevenge::RVNG_SEEK_SET);
-      parseFonts(input, *i);
+      parseFonts(input, *i, quill);
       parsedFont = true;
     }
     else if (i->name == "TCD ")
@@ -1139,18 +1176,18 @@ bool MSPUBParser::parseQuill(librevenge::RVNGInputStream *input)
         readParas.push_back(TextParagraph(readSpans, currentTextPara->paraStyle));
         MSPUB_DEBUG_MSG(("Saw paragraph %d in the current text block.\n", (unsigned)readParas.size()));
       }
-      m_collector->addTextString(readParas, textIDs[j]);
-      m_collector->setTextStringOffset(textIDs[j], textOffsets[j]);
+      quill.m_texts.push_back(QuillText(textIDs[j], textOffsets[j]));
+      quill.m_texts.back().m_paragraphs.swap(readParas);
       const std::map<unsigned, std::vector<unsigned> >::const_iterator it = tableCellTextEnds.find(j);
       if (it != tableCellTextEnds.end())
-        m_collector->setTableCellTextEnds(textIDs[j], it->second);
+        quill.m_texts.back().m_tableCellTextEnds = it->second;
     }
     textChunkReference = chunkReferences.end();
   }
   return true;
 }
 
-void MSPUBParser::parseFonts(librevenge::RVNGInputStream *input, const QuillChunkReference &)
+void MSPUBParser::parseFonts(MSPUBMemoryStream *input, const QuillChunkReference &, ParsedQuill &quill)
 {
   readU32(input);
   unsigned numElements = readU32(input);
@@ -1162,13 +1199,13 @@ void MSPUBParser::parseFonts(librevenge::RVNGInputStream *input, const QuillChun
     {
       std::vector<unsigned char> name;
       readNBytes(input, nameLength * 2, name);
-      m_collector->addFont(name);
+      quill.m_fonts.push_back(name);
     }
     readU32(input);
   }
 }
 
-void MSPUBParser::parseDefaultStyle(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk)
+void MSPUBParser::parseDefaultStyle(MSPUBMemoryStream *input, const QuillChunkReference &chunk, ParsedQuill &quill)
 {
   readU32(input);
   unsigned numElements = std::min(readU32(input), m_length);
@@ -1186,17 +1223,17 @@ void MSPUBParser::parseDefaultStyle(librevenge::RVNGInputStream *input, const Qu
     if (i % 2 == 0)
     {
       //FIXME: Does STSH2 hold information for associating style indices in FDPP to indices in STSH1 ?
-      m_collector->addDefaultCharacterStyle(getCharacterStyle(input));
+      quill.m_defaultCharStyles.push_back(getCharacterStyle(input));
     }
     else
     {
-      m_collector->addDefaultParagraphStyle(getParagraphStyle(input));
+      quill.m_defaultParaStyles.push_back(getParagraphStyle(input));
     }
   }
 }
 
 
-void MSPUBParser::parseColors(librevenge::RVNGInputStream *input, const QuillChunkReference &)
+void MSPUBParser::parseColors(MSPUBMemoryStream *input, const QuillChunkReference &, ParsedQuill &quill)
 {
   unsigned numEntries = readU32(input);
   input->seek(input->tell() + 8, librevenge::RVNG_SEEK_SET);
@@ -1209,13 +1246,13 @@ void MSPUBParser::parseColors(librevenge::RVNGInputStream *input, const QuillChu
       MSPUBBlockInfo info = parseBlock(input, true);
       if (info.id == 0x01)
       {
-        m_collector->addTextColor(ColorReference(info.data));
+        quill.m_textColors.push_back(ColorReference(info.data));
       }
     }
   }
 }
 
-std::vector<MSPUBParser::TextParagraphReference> MSPUBParser::parseParagraphStyles(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk)
+std::vector<MSPUBParser::TextParagraphReference> MSPUBParser::parseParagraphStyles(MSPUBMemoryStream *input, const QuillChunkReference &chunk)
 {
   std::vector<TextParagraphReference> ret;
   unsigned short numEntries = readU16(input);
@@ -1243,7 +1280,7 @@ std::vector<MSPUBParser::TextParagraphReference> MSPUBParser::parseParagraphStyl
   return ret;
 }
 
-std::vector<MSPUBParser::TextSpanReference> MSPUBParser::parseCharacterStyles(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk)
+std::vector<MSPUBParser::TextSpanReference> MSPUBParser::parseCharacterStyles(MSPUBMemoryStream *input, const QuillChunkReference &chunk)
 {
   unsigned short numEntries = readU16(input);
   input->seek(input->tell() + 6, librevenge::RVNG_SEEK_SET);
@@ -1270,7 +1307,7 @@ std::vector<MSPUBParser::TextSpanReference> MSPUBParser::parseCharacterStyles(li
   }
   return ret;
 }
-ParagraphStyle MSPUBParser::getParagraphStyle(librevenge::RVNGInputStream *input)
+ParagraphStyle MSPUBParser::getParagraphStyle(MSPUBMemoryStream *input)
 {
   ParagraphStyle ret;
 
@@ -1400,7 +1437,7 @@ ParagraphStyle MSPUBParser::getParagraphStyle(librevenge::RVNGInputStream *input
   return ret;
 }
 
-CharacterStyle MSPUBParser::getCharacterStyle(librevenge::RVNGInputStream *input)
+CharacterStyle MSPUBParser::getCharacterStyle(MSPUBMemoryStream *input)
 {
   CharacterStyle style;
 
@@ -1495,7 +1532,7 @@ CharacterStyle MSPUBParser::getCharacterStyle(librevenge::RVNGInputStream *input
   return style;
 }
 
-unsigned MSPUBParser::getFontIndex(librevenge::RVNGInputStream *input, const MSPUBBlockInfo &info)
+unsigned MSPUBParser::getFontIndex(MSPUBMemoryStream *input, const MSPUBBlockInfo &info)
 {
   MSPUB_DEBUG_MSG(("In getFontIndex\n"));
   input->seek(info.dataOffset + 4, librevenge::RVNG_SEEK_SET);
@@ -1516,7 +1553,7 @@ unsigned MSPUBParser::getFontIndex(librevenge::RVNGInputStream *input, const MSP
   return 0;
 }
 
-int MSPUBParser::getColorIndex(librevenge::RVNGInputStream *input, const MSPUBBlockInfo &info)
+int MSPUBParser::getColorIndex(MSPUBMemoryStream *input, const MSPUBBlockInfo &info)
 {
   input->seek(info.dataOffset + 4, librevenge::RVNG_SEEK_SET);
   while (stillReading(input, info.dataOffset + info.dataLength))
@@ -1533,7 +1570,7 @@ int MSPUBParser::getColorIndex(librevenge::RVNGInputStream *input, const MSPUBBl
   return -1;
 }
 
-bool MSPUBParser::parseEscher(librevenge::RVNGInputStream *input)
+bool MSPUBParser::parseEscher(MSPUBMemoryStream *input)
 {
   MSPUB_DEBUG_MSG(("MSPUBParser::parseEscher\n"));
   EscherContainerInfo fakeroot;
@@ -1572,14 +1609,14 @@ bool MSPUBParser::parseEscher(librevenge::RVNGInputStream *input)
     while (findEscherContainer(input, dg, spgr, OFFICE_ART_SPGR_CONTAINER))
     {
       Coordinate c1, c2;
-      parseShapeGroup(input, spgr, c1, c2);
+      parseShapeGroup(input, spgr, c1, c2, true);
     }
     input->seek(input->tell() + getEscherElementTailLength(OFFICE_ART_DG_CONTAINER), librevenge::RVNG_SEEK_SET);
   }
   return true;
 }
 
-void MSPUBParser::parseShapeGroup(librevenge::RVNGInputStream *input, const EscherContainerInfo &spgr, Coordinate parentCoordinateSystem, Coordinate parentGroupAbsoluteCoord)
+void MSPUBParser::parseShapeGroup(MSPUBMemoryStream *input, const EscherContainerInfo &spgr, Coordinate parentCoordinateSystem, Coordinate parentGroupAbsoluteCoord, const bool isTopLevel)
 {
   EscherContainerInfo shapeOrGroup;
   std::set<unsigned short> types;
@@ -1587,6 +1624,12 @@ void MSPUBParser::parseShapeGroup(librevenge::RVNGInputStream *input, const Esch
   types.insert(OFFICE_ART_SP_CONTAINER);
   while (findEscherContainerWithTypeInSet(input, spgr, shapeOrGroup, types))
   {
+    // pages only list their top level shapes and groups
+    if (isTopLevel && !isEscherShapeSelected(input, shapeOrGroup))
+    {
+      input->seek(shapeOrGroup.contentsOffset + shapeOrGroup.contentsLength + getEscherElementTailLength(shapeOrGroup.type), librevenge::RVNG_SEEK_SET);
+      continue;
+    }
     switch (shapeOrGroup.type)
     {
     case OFFICE_ART_SPGR_CONTAINER:
@@ -1602,7 +1645,7 @@ void MSPUBParser::parseShapeGroup(librevenge::RVNGInputStream *input, const Esch
   }
 }
 
-void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const EscherContainerInfo &sp, Coordinate &parentCoordinateSystem, Coordinate &parentGroupAbsoluteCoord)
+void MSPUBParser::parseEscherShape(MSPUBMemoryStream *input, const EscherContainerInfo &sp, Coordinate &parentCoordinateSystem, Coordinate &parentGroupAbsoluteCoord)
 {
   Coordinate thisParentCoordinateSystem = parentCoordinateSystem;
   bool definesRelativeCoordinates = false;
@@ -1615,7 +1658,8 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
   unsigned shapeFlags = 0;
   bool isGroupLeader = false;
   ShapeType st = RECTANGLE;
-  if (findEscherContainer(input, sp, cFspgr, OFFICE_ART_FSPGR))
+  const std::vector<EscherContainerInfo> children = readEscherChildren(input, sp);
+  if (findEscherChild(children, cFspgr, OFFICE_ART_FSPGR))
   {
     input->seek(cFspgr.contentsOffset, librevenge::RVNG_SEEK_SET);
     parentCoordinateSystem.m_xs = readU32(input);
@@ -1625,25 +1669,22 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
     parentCoordinateSystem.arrange();
     definesRelativeCoordinates = true;
   }
-  input->seek(sp.contentsOffset, librevenge::RVNG_SEEK_SET);
-  if (findEscherContainer(input, sp, cFsp, OFFICE_ART_FSP))
+  if (findEscherChild(children, cFsp, OFFICE_ART_FSP))
   {
     st = (ShapeType)(cFsp.initial >> 4);
-    std::map<unsigned short, unsigned> fspData = extractEscherValues(input, cFsp);
+    EscherValues fspData = extractEscherValues(input, cFsp);
     input->seek(cFsp.contentsOffset + 4, librevenge::RVNG_SEEK_SET);
     shapeFlags = readU32(input);
     isGroupLeader = shapeFlags & SF_GROUP;
   }
-  input->seek(sp.contentsOffset, librevenge::RVNG_SEEK_SET);
-  if (findEscherContainer(input, sp, cData, OFFICE_ART_CLIENT_DATA))
+  if (findEscherChild(children, cData, OFFICE_ART_CLIENT_DATA))
   {
-    std::map<unsigned short, unsigned> dataValues = extractEscherValues(input, cData);
-    unsigned *shapeSeqNum = getIfExists(dataValues, FIELDID_SHAPE_ID);
+    EscherValues dataValues = extractEscherValues(input, cData);
+    const unsigned *shapeSeqNum = dataValues.find(FIELDID_SHAPE_ID);
     if (shapeSeqNum)
     {
       m_collector->setShapeType(*shapeSeqNum, st);
       m_collector->setShapeFlip(*shapeSeqNum, shapeFlags & SF_FLIP_V, shapeFlags & SF_FLIP_H);
-      input->seek(sp.contentsOffset, librevenge::RVNG_SEEK_SET);
       if (isGroupLeader)
       {
         m_collector->setCurrentGroupSeqNum(*shapeSeqNum);
@@ -1656,33 +1697,30 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
       anchorTypes.insert(OFFICE_ART_CLIENT_ANCHOR);
       anchorTypes.insert(OFFICE_ART_CHILD_ANCHOR);
       bool foundAnchor;
-      if ((foundAnchor = findEscherContainerWithTypeInSet(input, sp, cAnchor, anchorTypes)) || isGroupLeader)
+      if ((foundAnchor = findEscherChildWithTypeInSet(children, cAnchor, anchorTypes)) || isGroupLeader)
       {
         bool rotated90 = false;
         MSPUB_DEBUG_MSG(("Found Escher data for %s of seqnum 0x%x\n", isGroupLeader ? "group" : "shape", *shapeSeqNum));
-        boost::optional<std::map<unsigned short, unsigned> > maybe_tertiaryFoptValues;
-        input->seek(sp.contentsOffset, librevenge::RVNG_SEEK_SET);
-        if (findEscherContainer(input, sp, cTertiaryFopt, OFFICE_ART_TERTIARY_FOPT))
+        boost::optional<EscherValues> maybe_tertiaryFoptValues;
+        if (findEscherChild(children, cTertiaryFopt, OFFICE_ART_TERTIARY_FOPT))
         {
           maybe_tertiaryFoptValues = extractEscherValues(input, cTertiaryFopt);
         }
         if (bool(maybe_tertiaryFoptValues))
         {
-          const std::map<unsigned short, unsigned> &tertiaryFoptValues =
+          const EscherValues &tertiaryFoptValues =
             maybe_tertiaryFoptValues.get();
-          const unsigned *ptr_pictureRecolor = getIfExists_const(tertiaryFoptValues,
-                                                                 FIELDID_PICTURE_RECOLOR);
+          const unsigned *ptr_pictureRecolor = tertiaryFoptValues.find(FIELDID_PICTURE_RECOLOR);
           if (ptr_pictureRecolor)
           {
             m_collector->setShapePictureRecolor(*shapeSeqNum,
                                                 ColorReference(*ptr_pictureRecolor));
           }
         }
-        input->seek(sp.contentsOffset, librevenge::RVNG_SEEK_SET);
-        if (findEscherContainer(input, sp, cFopt, OFFICE_ART_FOPT))
+        if (findEscherChild(children, cFopt, OFFICE_ART_FOPT))
         {
           FOPTValues foptValues = extractFOPTValues(input, cFopt);
-          unsigned *pxId = getIfExists(foptValues.m_scalarValues, FIELDID_PXID);
+          const unsigned *pxId = foptValues.m_scalarValues.find(FIELDID_PXID);
           if (pxId)
           {
             MSPUB_DEBUG_MSG(("Current Escher shape has pxId %d\n", *pxId));
@@ -1694,29 +1732,29 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
             {
               MSPUB_DEBUG_MSG(("Couldn't find corresponding escherDelay index\n"));
             }
-            unsigned *ptr_pictureBrightness = getIfExists(foptValues.m_scalarValues, FIELDID_PICTURE_BRIGHTNESS);
+            const unsigned *ptr_pictureBrightness = foptValues.m_scalarValues.find(FIELDID_PICTURE_BRIGHTNESS);
             if (ptr_pictureBrightness)
             {
               m_collector->setShapePictureBrightness(*shapeSeqNum, (int)(*ptr_pictureBrightness));
             }
-            unsigned *ptr_pictureContrast = getIfExists(foptValues.m_scalarValues, FIELDID_PICTURE_CONTRAST);
+            const unsigned *ptr_pictureContrast = foptValues.m_scalarValues.find(FIELDID_PICTURE_CONTRAST);
             if (ptr_pictureContrast)
             {
               m_collector->setShapePictureContrast(*shapeSeqNum, (int)(*ptr_pictureContrast));
             }
           }
-          unsigned *ptr_lineBackColor =
-            getIfExists(foptValues.m_scalarValues, FIELDID_LINE_BACK_COLOR);
+          const unsigned *ptr_lineBackColor =
+            foptValues.m_scalarValues.find(FIELDID_LINE_BACK_COLOR);
           if (ptr_lineBackColor &&
               static_cast<int>(*ptr_lineBackColor) != -1)
           {
             m_collector->setShapeLineBackColor(
               *shapeSeqNum, ColorReference(*ptr_lineBackColor));
           }
-          unsigned *ptr_lineColor = getIfExists(foptValues.m_scalarValues, FIELDID_LINE_COLOR);
-          unsigned *ptr_lineFlags = getIfExists(foptValues.m_scalarValues, FIELDID_LINE_STYLE_BOOL_PROPS);
-          unsigned *ptr_geomFlags = getIfExists(
-                                      foptValues.m_scalarValues, FIELDID_GEOM_BOOL_PROPS);
+          const unsigned *ptr_lineColor = foptValues.m_scalarValues.find(FIELDID_LINE_COLOR);
+          const unsigned *ptr_lineFlags = foptValues.m_scalarValues.find(FIELDID_LINE_STYLE_BOOL_PROPS);
+          const unsigned *ptr_geomFlags =
+            foptValues.m_scalarValues.find(FIELDID_GEOM_BOOL_PROPS);
           bool useLine = lineExistsByFlagPointer(
                            ptr_lineFlags, ptr_geomFlags);
           bool skipIfNotBg = false;
@@ -1726,7 +1764,7 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
           {
             if (ptr_lineColor)
             {
-              unsigned *ptr_lineWidth = getIfExists(foptValues.m_scalarValues, FIELDID_LINE_WIDTH);
+              const unsigned *ptr_lineWidth = foptValues.m_scalarValues.find(FIELDID_LINE_WIDTH);
               lineWidth = ptr_lineWidth ? *ptr_lineWidth : 9525;
               m_collector->addShapeLine(*shapeSeqNum, Line(ColorReference(*ptr_lineColor), lineWidth, true));
             }
@@ -1734,23 +1772,23 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
             {
               if (bool(maybe_tertiaryFoptValues))
               {
-                std::map<unsigned short, unsigned> &tertiaryFoptValues =
+                const EscherValues &tertiaryFoptValues =
                   maybe_tertiaryFoptValues.get();
-                unsigned *ptr_tertiaryLineFlags = getIfExists(tertiaryFoptValues, FIELDID_LINE_STYLE_BOOL_PROPS);
+                const unsigned *ptr_tertiaryLineFlags = tertiaryFoptValues.find(FIELDID_LINE_STYLE_BOOL_PROPS);
                 if (lineExistsByFlagPointer(ptr_tertiaryLineFlags))
                 {
-                  unsigned *ptr_topColor = getIfExists(tertiaryFoptValues, FIELDID_LINE_TOP_COLOR);
-                  unsigned *ptr_topWidth = getIfExists(tertiaryFoptValues, FIELDID_LINE_TOP_WIDTH);
-                  unsigned *ptr_topFlags = getIfExists(tertiaryFoptValues, FIELDID_LINE_TOP_BOOL_PROPS);
-                  unsigned *ptr_rightColor = getIfExists(tertiaryFoptValues, FIELDID_LINE_RIGHT_COLOR);
-                  unsigned *ptr_rightWidth = getIfExists(tertiaryFoptValues, FIELDID_LINE_RIGHT_WIDTH);
-                  unsigned *ptr_rightFlags = getIfExists(tertiaryFoptValues, FIELDID_LINE_RIGHT_BOOL_PROPS);
-                  unsigned *ptr_bottomColor = getIfExists(tertiaryFoptValues, FIELDID_LINE_BOTTOM_COLOR);
-                  unsigned *ptr_bottomWidth = getIfExists(tertiaryFoptValues, FIELDID_LINE_BOTTOM_WIDTH);
-                  unsigned *ptr_bottomFlags = getIfExists(tertiaryFoptValues, FIELDID_LINE_BOTTOM_BOOL_PROPS);
-                  unsigned *ptr_leftColor = getIfExists(tertiaryFoptValues, FIELDID_LINE_LEFT_COLOR);
-                  unsigned *ptr_leftWidth = getIfExists(tertiaryFoptValues, FIELDID_LINE_LEFT_WIDTH);
-                  unsigned *ptr_leftFlags = getIfExists(tertiaryFoptValues, FIELDID_LINE_LEFT_BOOL_PROPS);
+                  const unsigned *ptr_topColor = tertiaryFoptValues.find(FIELDID_LINE_TOP_COLOR);
+                  const unsigned *ptr_topWidth = tertiaryFoptValues.find(FIELDID_LINE_TOP_WIDTH);
+                  const unsigned *ptr_topFlags = tertiaryFoptValues.find(FIELDID_LINE_TOP_BOOL_PROPS);
+                  const unsigned *ptr_rightColor = tertiaryFoptValues.find(FIELDID_LINE_RIGHT_COLOR);
+                  const unsigned *ptr_rightWidth = tertiaryFoptValues.find(FIELDID_LINE_RIGHT_WIDTH);
+                  const unsigned *ptr_rightFlags = tertiaryFoptValues.find(FIELDID_LINE_RIGHT_BOOL_PROPS);
+                  const unsigned *ptr_bottomColor = tertiaryFoptValues.find(FIELDID_LINE_BOTTOM_COLOR);
+                  const unsigned *ptr_bottomWidth = tertiaryFoptValues.find(FIELDID_LINE_BOTTOM_WIDTH);
+                  const unsigned *ptr_bottomFlags = tertiaryFoptValues.find(FIELDID_LINE_BOTTOM_BOOL_PROPS);
+                  const unsigned *ptr_leftColor = tertiaryFoptValues.find(FIELDID_LINE_LEFT_COLOR);
+                  const unsigned *ptr_leftWidth = tertiaryFoptValues.find(FIELDID_LINE_LEFT_WIDTH);
+                  const unsigned *ptr_leftFlags = tertiaryFoptValues.find(FIELDID_LINE_LEFT_BOOL_PROPS);
 
                   bool topExists = ptr_topColor && lineExistsByFlagPointer(ptr_topFlags);
                   bool rightExists = ptr_rightColor && lineExistsByFlagPointer(ptr_rightFlags);
@@ -1796,9 +1834,9 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
           {
             m_collector->setShapeFill(*shapeSeqNum, ptr_fill, skipIfNotBg);
           }
-          int *ptr_adjust1 = (int *)getIfExists(foptValues.m_scalarValues, FIELDID_ADJUST_VALUE_1);
-          int *ptr_adjust2 = (int *)getIfExists(foptValues.m_scalarValues, FIELDID_ADJUST_VALUE_2);
-          int *ptr_adjust3 = (int *)getIfExists(foptValues.m_scalarValues, FIELDID_ADJUST_VALUE_3);
+          const int *ptr_adjust1 = (const int *)foptValues.m_scalarValues.find(FIELDID_ADJUST_VALUE_1);
+          const int *ptr_adjust2 = (const int *)foptValues.m_scalarValues.find(FIELDID_ADJUST_VALUE_2);
+          const int *ptr_adjust3 = (const int *)foptValues.m_scalarValues.find(FIELDID_ADJUST_VALUE_3);
           if (ptr_adjust1)
           {
             m_collector->setAdjustValue(*shapeSeqNum, 0, *ptr_adjust1);
@@ -1811,7 +1849,7 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
           {
             m_collector->setAdjustValue(*shapeSeqNum, 2, *ptr_adjust3);
           }
-          int *ptr_rotation = (int *)getIfExists(foptValues.m_scalarValues, FIELDID_ROTATION);
+          const int *ptr_rotation = (const int *)foptValues.m_scalarValues.find(FIELDID_ROTATION);
           if (ptr_rotation)
           {
             double rotation = doubleModulo(toFixedPoint(*ptr_rotation), 360);
@@ -1820,16 +1858,16 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
             rotated90 = (rotation >= 45 && rotation < 135) || (rotation >= 225 && rotation < 315);
 
           }
-          unsigned *ptr_left = getIfExists(foptValues.m_scalarValues, FIELDID_DY_TEXT_LEFT);
-          unsigned *ptr_top = getIfExists(foptValues.m_scalarValues, FIELDID_DY_TEXT_TOP);
-          unsigned *ptr_right = getIfExists(foptValues.m_scalarValues, FIELDID_DY_TEXT_RIGHT);
-          unsigned *ptr_bottom = getIfExists(foptValues.m_scalarValues, FIELDID_DY_TEXT_BOTTOM);
+          const unsigned *ptr_left = foptValues.m_scalarValues.find(FIELDID_DY_TEXT_LEFT);
+          const unsigned *ptr_top = foptValues.m_scalarValues.find(FIELDID_DY_TEXT_TOP);
+          const unsigned *ptr_right = foptValues.m_scalarValues.find(FIELDID_DY_TEXT_RIGHT);
+          const unsigned *ptr_bottom = foptValues.m_scalarValues.find(FIELDID_DY_TEXT_BOTTOM);
           m_collector->setShapeMargins(*shapeSeqNum, ptr_left ? *ptr_left : DEFAULT_MARGIN,
                                        ptr_top ? *ptr_top : DEFAULT_MARGIN,
                                        ptr_right ? *ptr_right : DEFAULT_MARGIN,
                                        ptr_bottom ? *ptr_bottom : DEFAULT_MARGIN);
-          unsigned *ptr_lineDashing = getIfExists(foptValues.m_scalarValues, FIELDID_LINE_DASHING);
-          unsigned *ptr_lineEndcapStyle = getIfExists(foptValues.m_scalarValues, FIELDID_LINE_ENDCAP_STYLE);
+          const unsigned *ptr_lineDashing = foptValues.m_scalarValues.find(FIELDID_LINE_DASHING);
+          const unsigned *ptr_lineEndcapStyle = foptValues.m_scalarValues.find(FIELDID_LINE_ENDCAP_STYLE);
           DotStyle dotStyle = RECT_DOT;
           if (ptr_lineEndcapStyle)
           {
@@ -1851,24 +1889,21 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
 
           if (bool(maybe_tertiaryFoptValues))
           {
-            std::map<unsigned short, unsigned> &tertiaryFoptValues = maybe_tertiaryFoptValues.get();
-            unsigned *ptr_numColumns = getIfExists(tertiaryFoptValues, FIELDID_NUM_COLUMNS);
+            const EscherValues &tertiaryFoptValues = maybe_tertiaryFoptValues.get();
+            const unsigned *ptr_numColumns = tertiaryFoptValues.find(FIELDID_NUM_COLUMNS);
             if (ptr_numColumns)
             {
               m_collector->setShapeNumColumns(*shapeSeqNum, *ptr_numColumns);
             }
-            unsigned *ptr_columnSpacing = getIfExists(tertiaryFoptValues, FIELDID_COLUMN_SPACING);
+            const unsigned *ptr_columnSpacing = tertiaryFoptValues.find(FIELDID_COLUMN_SPACING);
             if (ptr_columnSpacing)
             {
               m_collector->setShapeColumnSpacing(*shapeSeqNum, *ptr_columnSpacing);
             }
           }
-          unsigned *ptr_beginArrowStyle = getIfExists(foptValues.m_scalarValues,
-                                                      FIELDID_BEGIN_ARROW_STYLE);
-          unsigned *ptr_beginArrowWidth = getIfExists(foptValues.m_scalarValues,
-                                                      FIELDID_BEGIN_ARROW_WIDTH);
-          unsigned *ptr_beginArrowHeight = getIfExists(foptValues.m_scalarValues,
-                                                       FIELDID_BEGIN_ARROW_HEIGHT);
+          const unsigned *ptr_beginArrowStyle = foptValues.m_scalarValues.find(FIELDID_BEGIN_ARROW_STYLE);
+          const unsigned *ptr_beginArrowWidth = foptValues.m_scalarValues.find(FIELDID_BEGIN_ARROW_WIDTH);
+          const unsigned *ptr_beginArrowHeight = foptValues.m_scalarValues.find(FIELDID_BEGIN_ARROW_HEIGHT);
           m_collector->setShapeBeginArrow(*shapeSeqNum, Arrow(
                                             ptr_beginArrowStyle ? (ArrowStyle)(*ptr_beginArrowStyle) :
                                             NO_ARROW,
@@ -1876,12 +1911,9 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
                                             MEDIUM,
                                             ptr_beginArrowHeight ? (ArrowSize)(*ptr_beginArrowHeight) :
                                             MEDIUM));
-          unsigned *ptr_endArrowStyle = getIfExists(foptValues.m_scalarValues,
-                                                    FIELDID_END_ARROW_STYLE);
-          unsigned *ptr_endArrowWidth = getIfExists(foptValues.m_scalarValues,
-                                                    FIELDID_END_ARROW_WIDTH);
-          unsigned *ptr_endArrowHeight = getIfExists(foptValues.m_scalarValues,
-                                                     FIELDID_END_ARROW_HEIGHT);
+          const unsigned *ptr_endArrowStyle = foptValues.m_scalarValues.find(FIELDID_END_ARROW_STYLE);
+          const unsigned *ptr_endArrowWidth = foptValues.m_scalarValues.find(FIELDID_END_ARROW_WIDTH);
+          const unsigned *ptr_endArrowHeight = foptValues.m_scalarValues.find(FIELDID_END_ARROW_HEIGHT);
           m_collector->setShapeEndArrow(*shapeSeqNum, Arrow(
                                           ptr_endArrowStyle ? (ArrowStyle)(*ptr_endArrowStyle) :
                                           NO_ARROW,
@@ -1890,23 +1922,23 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
                                           ptr_endArrowHeight ? (ArrowSize)(*ptr_endArrowHeight) :
                                           MEDIUM));
 
-          unsigned *shadowBoolProps = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_BOOL_PROPS);
+          const unsigned *shadowBoolProps = foptValues.m_scalarValues.find(FIELDID_SHADOW_BOOL_PROPS);
           if (shadowBoolProps)
           {
             unsigned shadowProps = *shadowBoolProps;
             if ((shadowProps & FLAG_USE_FSHADOW) && (shadowProps & FLAG_USE_SHADOW))
             {
-              unsigned *ptr_shadowType = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_TYPE);
+              const unsigned *ptr_shadowType = foptValues.m_scalarValues.find(FIELDID_SHADOW_TYPE);
               auto shadowType = static_cast<ShadowType>(ptr_shadowType ? *ptr_shadowType : 0);
-              unsigned *shadowColor = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_COLOR);
-              unsigned *shadowHColor = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_HIGHLIGHT);
-              unsigned *shadowOpacity = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_OPACITY);
-              unsigned *shadowOffsetX = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_OFFSET_X);
-              unsigned *shadowOffsetY = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_OFFSET_Y);
-              unsigned *shadowOffsetX2 = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_SECOND_OFFSET_X);
-              unsigned *shadowOffsetY2 = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_SECOND_OFFSET_Y);
-              unsigned *shadowOriginX = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_ORIGIN_X);
-              unsigned *shadowOriginY = getIfExists(foptValues.m_scalarValues, FIELDID_SHADOW_ORIGIN_Y);
+              const unsigned *shadowColor = foptValues.m_scalarValues.find(FIELDID_SHADOW_COLOR);
+              const unsigned *shadowHColor = foptValues.m_scalarValues.find(FIELDID_SHADOW_HIGHLIGHT);
+              const unsigned *shadowOpacity = foptValues.m_scalarValues.find(FIELDID_SHADOW_OPACITY);
+              const unsigned *shadowOffsetX = foptValues.m_scalarValues.find(FIELDID_SHADOW_OFFSET_X);
+              const unsigned *shadowOffsetY = foptValues.m_scalarValues.find(FIELDID_SHADOW_OFFSET_Y);
+              const unsigned *shadowOffsetX2 = foptValues.m_scalarValues.find(FIELDID_SHADOW_SECOND_OFFSET_X);
+              const unsigned *shadowOffsetY2 = foptValues.m_scalarValues.find(FIELDID_SHADOW_SECOND_OFFSET_Y);
+              const unsigned *shadowOriginX = foptValues.m_scalarValues.find(FIELDID_SHADOW_ORIGIN_X);
+              const unsigned *shadowOriginY = foptValues.m_scalarValues.find(FIELDID_SHADOW_ORIGIN_Y);
               m_collector->setShapeShadow(*shapeSeqNum, Shadow(shadowType,
                                                                shadowOffsetX ? static_cast<int>(*shadowOffsetX) : 0x6338,
                                                                shadowOffsetY ? static_cast<int>(*shadowOffsetY) : 0x6338,
@@ -1922,20 +1954,18 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
             }
           }
 
-          const std::vector<unsigned char> vertexData = foptValues.m_complexValues[FIELDID_P_VERTICES];
+          const ByteView vertexData = foptValues.m_complexValues.get(FIELDID_P_VERTICES);
           if (!vertexData.empty())
           {
-            unsigned *p_geoRight = getIfExists(foptValues.m_scalarValues,
-                                               FIELDID_GEO_RIGHT);
-            unsigned *p_geoBottom = getIfExists(foptValues.m_scalarValues,
-                                                FIELDID_GEO_BOTTOM);
-            const std::vector<unsigned char> segmentData = foptValues.m_complexValues[FIELDID_P_SEGMENTS];
-            const std::vector<unsigned char> guideData = foptValues.m_complexValues[FIELDID_P_GUIDES];
+            const unsigned *p_geoRight = foptValues.m_scalarValues.find(FIELDID_GEO_RIGHT);
+            const unsigned *p_geoBottom = foptValues.m_scalarValues.find(FIELDID_GEO_BOTTOM);
+            const ByteView segmentData = foptValues.m_complexValues.get(FIELDID_P_SEGMENTS);
+            const ByteView guideData = foptValues.m_complexValues.get(FIELDID_P_GUIDES);
             m_collector->setShapeCustomPath(*shapeSeqNum, getDynamicCustomShape(vertexData, segmentData,
                                                                                 guideData, p_geoRight ? *p_geoRight : 21600,
                                                                                 p_geoBottom ? *p_geoBottom : 21600));
           }
-          const std::vector<unsigned char> wrapVertexData = foptValues.m_complexValues[FIELDID_P_WRAPPOLYGONVERTICES];
+          const ByteView wrapVertexData = foptValues.m_complexValues.get(FIELDID_P_WRAPPOLYGONVERTICES);
           if (!wrapVertexData.empty())
           {
             std::vector<Vertex> ret = parseVertices(wrapVertexData);
@@ -1947,10 +1977,10 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
           Coordinate absolute;
           if (cAnchor.type == OFFICE_ART_CLIENT_ANCHOR)
           {
-            std::map<unsigned short, unsigned> anchorData = extractEscherValues(input, cAnchor);
-            absolute = Coordinate(anchorData[FIELDID_XS],
-                                  anchorData[FIELDID_YS], anchorData[FIELDID_XE],
-                                  anchorData[FIELDID_YE]);
+            const EscherValues anchorData = extractEscherValues(input, cAnchor);
+            absolute = Coordinate(anchorData.get(FIELDID_XS),
+                                  anchorData.get(FIELDID_YS), anchorData.get(FIELDID_XE),
+                                  anchorData.get(FIELDID_YE));
           }
           else if (cAnchor.type == OFFICE_ART_CHILD_ANCHOR)
           {
@@ -1999,22 +2029,22 @@ void MSPUBParser::parseEscherShape(librevenge::RVNGInputStream *input, const Esc
   }
 }
 
-std::shared_ptr<Fill> MSPUBParser::getNewFill(const std::map<unsigned short, unsigned> &foptProperties,
-                                              bool &skipIfNotBg, std::map<unsigned short, std::vector<unsigned char> > &foptValues)
+std::shared_ptr<Fill> MSPUBParser::getNewFill(const EscherValues &foptProperties,
+                                              bool &skipIfNotBg, const EscherComplexValues &foptValues)
 {
-  const FillType *ptr_fillType = (FillType *)getIfExists_const(foptProperties, FIELDID_FILL_TYPE);
+  const FillType *ptr_fillType = (FillType *)foptProperties.find(FIELDID_FILL_TYPE);
   FillType fillType = ptr_fillType ? *ptr_fillType : SOLID;
   switch (fillType)
   {
   case SOLID:
   {
-    const unsigned *ptr_fillColor = getIfExists_const(foptProperties, FIELDID_FILL_COLOR);
-    const unsigned *ptr_fieldStyleProps = getIfExists_const(foptProperties, FIELDID_FIELD_STYLE_BOOL_PROPS);
+    const unsigned *ptr_fillColor = foptProperties.find(FIELDID_FILL_COLOR);
+    const unsigned *ptr_fieldStyleProps = foptProperties.find(FIELDID_FIELD_STYLE_BOOL_PROPS);
     skipIfNotBg = ptr_fieldStyleProps && (*ptr_fieldStyleProps & 0xF0) == 0;
     if (ptr_fillColor && !skipIfNotBg)
     {
-      const unsigned *ptr_fillOpacity = getIfExists_const(foptProperties, FIELDID_FILL_OPACITY);
-      return std::shared_ptr<Fill>(new SolidFill(ColorReference(*ptr_fillColor), ptr_fillOpacity ? (double)(*ptr_fillOpacity) / 0xFFFF : 1, m_collector));
+      const unsigned *ptr_fillOpacity = foptProperties.find(FIELDID_FILL_OPACITY);
+      return std::shared_ptr<Fill>(new SolidFill(ColorReference(*ptr_fillColor), ptr_fillOpacity ? (double)(*ptr_fillOpacity) / 0xFFFF : 1));
     }
     return std::shared_ptr<Fill>();
   }
@@ -2024,16 +2054,16 @@ std::shared_ptr<Fill> MSPUBParser::getNewFill(const std::map<unsigned short, uns
   case SHADE_SCALE:
   {
     int angle;
-    const int *ptr_angle = (const int *)getIfExists_const(foptProperties, FIELDID_FILL_ANGLE);
-    const unsigned *ptr_fillColor = getIfExists_const(foptProperties, FIELDID_FILL_COLOR);
-    const unsigned *ptr_fillBackColor = getIfExists_const(foptProperties, FIELDID_FILL_BACK_COLOR);
+    const int *ptr_angle = (const int *)foptProperties.find(FIELDID_FILL_ANGLE);
+    const unsigned *ptr_fillColor = foptProperties.find(FIELDID_FILL_COLOR);
+    const unsigned *ptr_fillBackColor = foptProperties.find(FIELDID_FILL_BACK_COLOR);
     unsigned fill = ptr_fillColor ? *ptr_fillColor : 0x00FFFFFFF;
     unsigned fillBack = ptr_fillBackColor ? *ptr_fillBackColor : 0x00FFFFFF;
     ColorReference firstColor(fill, fill);
     ColorReference secondColor(fill, fillBack);
-    const unsigned *ptr_fillOpacity = getIfExists_const(foptProperties, FIELDID_FILL_OPACITY);
-    const unsigned *ptr_fillBackOpacity = getIfExists_const(foptProperties, FIELDID_FILL_BACK_OPACITY);
-    const unsigned *ptr_fillFocus = getIfExists_const(foptProperties, FIELDID_FILL_FOCUS);
+    const unsigned *ptr_fillOpacity = foptProperties.find(FIELDID_FILL_OPACITY);
+    const unsigned *ptr_fillBackOpacity = foptProperties.find(FIELDID_FILL_BACK_OPACITY);
+    const unsigned *ptr_fillFocus = foptProperties.find(FIELDID_FILL_FOCUS);
     short fillFocus = ptr_fillFocus ? int((*ptr_fillFocus << 16) >> 16) : 0;
     angle = ptr_angle ? *ptr_angle : 0;
     angle >>= 16; //it's actually only 16 bits
@@ -2052,34 +2082,34 @@ std::shared_ptr<Fill> MSPUBParser::getNewFill(const std::map<unsigned short, uns
       break;
     }
     double fillLeftVal = 0.0;
-    const unsigned *ptr_fillLeft = getIfExists_const(foptProperties, FIELDID_FILL_TO_LEFT);
+    const unsigned *ptr_fillLeft = foptProperties.find(FIELDID_FILL_TO_LEFT);
     if (ptr_fillLeft)
       fillLeftVal = toFixedPoint(*ptr_fillLeft);
     double fillTopVal = 0.0;
-    const unsigned *ptr_fillTop = getIfExists_const(foptProperties, FIELDID_FILL_TO_TOP);
+    const unsigned *ptr_fillTop = foptProperties.find(FIELDID_FILL_TO_TOP);
     if (ptr_fillTop)
       fillTopVal = toFixedPoint(*ptr_fillTop);
     double fillRightVal = 0.0;
-    const unsigned *ptr_fillRight = getIfExists_const(foptProperties, FIELDID_FILL_TO_RIGHT);
+    const unsigned *ptr_fillRight = foptProperties.find(FIELDID_FILL_TO_RIGHT);
     if (ptr_fillRight)
       fillRightVal = toFixedPoint(*ptr_fillRight);
     double fillBottomVal = 0.0;
-    const unsigned *ptr_fillBottom = getIfExists_const(foptProperties, FIELDID_FILL_TO_BOTTOM);
+    const unsigned *ptr_fillBottom = foptProperties.find(FIELDID_FILL_TO_BOTTOM);
     if (ptr_fillBottom)
       fillBottomVal = toFixedPoint(*ptr_fillBottom);
 
-    std::shared_ptr<GradientFill> ret(new GradientFill(m_collector, angle, (int)fillType));
+    std::shared_ptr<GradientFill> ret(new GradientFill(angle, (int)fillType));
     ret->setFillCenter(fillLeftVal, fillTopVal, fillRightVal, fillBottomVal);
 
-    const unsigned *ptr_fillGrad = getIfExists_const(foptProperties, FIELDID_FILL_SHADE_COMPLEX);
+    const unsigned *ptr_fillGrad = foptProperties.find(FIELDID_FILL_SHADE_COMPLEX);
     if (ptr_fillGrad)
     {
-      const std::vector<unsigned char> gradientData = foptValues[FIELDID_FILL_SHADE_COMPLEX];
+      const ByteView gradientData = foptValues.get(FIELDID_FILL_SHADE_COMPLEX);
       if (gradientData.size() > 6)
       {
         unsigned short numEntries = gradientData[0] | (gradientData[1] << 8);
         unsigned offs = 6;
-        for (unsigned i = 0; i < numEntries; ++i)
+        for (unsigned i = 0; i < numEntries && offs + 8 <= gradientData.size(); ++i)
         {
           unsigned color = gradientData[offs] | (unsigned(gradientData[offs + 1]) << 8) | (unsigned(gradientData[offs + 2]) << 16) | (unsigned(gradientData[offs + 3]) << 24);
           offs += 4;
@@ -2139,27 +2169,27 @@ std::shared_ptr<Fill> MSPUBParser::getNewFill(const std::map<unsigned short, uns
   {
     // in the case the shape is rotated we must rotate the image too
     int rotation = 0;
-    const int *ptr_rotation = (const int *)getIfExists_const(foptProperties, FIELDID_ROTATION);
+    const int *ptr_rotation = (const int *)foptProperties.find(FIELDID_ROTATION);
     if (ptr_rotation)
       rotation = (int)doubleModulo(toFixedPoint(*ptr_rotation), 360);
-    const unsigned *ptr_bgPxId = getIfExists_const(foptProperties, FIELDID_BG_PXID);
+    const unsigned *ptr_bgPxId = foptProperties.find(FIELDID_BG_PXID);
     if (ptr_bgPxId && *ptr_bgPxId > 0 && *ptr_bgPxId <= m_escherDelayIndices.size() && m_escherDelayIndices[*ptr_bgPxId - 1] >= 0)
     {
-      return std::shared_ptr<Fill>(new ImgFill(m_escherDelayIndices[*ptr_bgPxId - 1], m_collector, fillType == TEXTURE, rotation));
+      return std::shared_ptr<Fill>(new ImgFill(m_escherDelayIndices[*ptr_bgPxId - 1], fillType == TEXTURE, rotation));
     }
     return std::shared_ptr<Fill>();
   }
   case PATTERN:
   {
-    const unsigned *ptr_bgPxId = getIfExists_const(foptProperties, FIELDID_BG_PXID);
-    const unsigned *ptr_fillColor = getIfExists_const(foptProperties, FIELDID_FILL_COLOR);
-    const unsigned *ptr_fillBackColor = getIfExists_const(foptProperties, FIELDID_FILL_BACK_COLOR);
+    const unsigned *ptr_bgPxId = foptProperties.find(FIELDID_BG_PXID);
+    const unsigned *ptr_fillColor = foptProperties.find(FIELDID_FILL_COLOR);
+    const unsigned *ptr_fillBackColor = foptProperties.find(FIELDID_FILL_BACK_COLOR);
     ColorReference fill = ptr_fillColor ? ColorReference(*ptr_fillColor) : ColorReference(0x00FFFFFF);
 //    ColorReference back = ptr_fillBackColor ? ColorReference(*ptr_fillBackColor) : ColorReference(0x08000000);
     ColorReference back = ptr_fillBackColor ? ColorReference(*ptr_fillBackColor) : ColorReference(0x00FFFFFF);
     if (ptr_bgPxId && *ptr_bgPxId > 0 && *ptr_bgPxId <= m_escherDelayIndices.size() && m_escherDelayIndices[*ptr_bgPxId - 1] >= 0)
     {
-      return std::shared_ptr<Fill>(new PatternFill(m_escherDelayIndices[*ptr_bgPxId - 1], m_collector, fill, back));
+      return std::shared_ptr<Fill>(new PatternFill(m_escherDelayIndices[*ptr_bgPxId - 1], fill, back));
     }
     return std::shared_ptr<Fill>();
   }
@@ -2170,8 +2200,8 @@ std::shared_ptr<Fill> MSPUBParser::getNewFill(const std::map<unsigned short, uns
 }
 
 DynamicCustomShape MSPUBParser::getDynamicCustomShape(
-  const std::vector<unsigned char> &vertexData, const std::vector<unsigned char> &segmentData,
-  const std::vector<unsigned char> &guideData, unsigned geoWidth,
+  const ByteView &vertexData, const ByteView &segmentData,
+  const ByteView &guideData, unsigned geoWidth,
   unsigned geoHeight)
 {
   DynamicCustomShape ret(geoWidth, geoHeight);
@@ -2182,7 +2212,7 @@ DynamicCustomShape MSPUBParser::getDynamicCustomShape(
 }
 
 std::vector<unsigned short> MSPUBParser::parseSegments(
-  const std::vector<unsigned char> &segmentData)
+  const ByteView &segmentData)
 {
   std::vector<unsigned short> ret;
   if (segmentData.size() < 6)
@@ -2205,7 +2235,7 @@ std::vector<unsigned short> MSPUBParser::parseSegments(
 }
 
 std::vector<Calculation> MSPUBParser::parseGuides(
-  const std::vector<unsigned char> &/* guideData */)
+  const ByteView &/* guideData */)
 {
   std::vector<Calculation> ret;
 
@@ -2215,7 +2245,7 @@ std::vector<Calculation> MSPUBParser::parseGuides(
 }
 
 std::vector<Vertex> MSPUBParser::parseVertices(
-  const std::vector<unsigned char> &vertexData)
+  const ByteView &vertexData)
 {
   std::vector<Vertex> ret;
   if (vertexData.size() < 6)
@@ -2293,7 +2323,7 @@ unsigned MSPUBParser::getEscherElementAdditionalHeaderLength(unsigned short type
   return 0;
 }
 
-bool MSPUBParser::findEscherContainerWithTypeInSet(librevenge::RVNGInputStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, std::set<unsigned short> types)
+bool MSPUBParser::findEscherContainerWithTypeInSet(MSPUBMemoryStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, std::set<unsigned short> types)
 {
   while (stillReading(input, parent.contentsOffset + parent.contentsLength))
   {
@@ -2308,7 +2338,7 @@ bool MSPUBParser::findEscherContainerWithTypeInSet(librevenge::RVNGInputStream *
   return false;
 }
 
-bool MSPUBParser::findEscherContainer(librevenge::RVNGInputStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, unsigned short desiredType)
+bool MSPUBParser::findEscherContainer(MSPUBMemoryStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, unsigned short desiredType)
 {
   MSPUB_DEBUG_MSG(("At offset 0x%lx, attempting to find escher container of type 0x%x\n", input->tell(), desiredType));
   while (stillReading(input, parent.contentsOffset + parent.contentsLength))
@@ -2324,21 +2354,68 @@ bool MSPUBParser::findEscherContainer(librevenge::RVNGInputStream *input, const
   return false;
 }
 
-FOPTValues MSPUBParser::extractFOPTValues(librevenge::RVNGInputStream *input, const EscherContainerInfo &record)
+std::vector<EscherContainerInfo> MSPUBParser::readEscherChildren(MSPUBMemoryStream *input, const EscherContainerInfo &parent)
+{
+  std::vector<EscherContainerInfo> children;
+  input->seek(parent.contentsOffset, librevenge::RVNG_SEEK_SET);
+  try
+  {
+    while (stillReading(input, parent.contentsOffset + parent.contentsLength))
+    {
+      children.push_back(parseEscherContainer(input));
+      const EscherContainerInfo &child = children.back();
+      input->seek(child.contentsOffset + child.contentsLength + getEscherElementTailLength(child.type), librevenge::RVNG_SEEK_SET);
+    }
+  }
+  catch (const EndOfStreamException &)
+  {
+    // keep the children before a truncated header
+  }
+  return children;
+}
+
+bool MSPUBParser::findEscherChild(const std::vector<EscherContainerInfo> &children, EscherContainerInfo &out, const unsigned short type)
+{
+  for (const auto &child : children)
+  {
+    if (child.type == type)
+    {
+      out = child;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MSPUBParser::findEscherChildWithTypeInSet(const std::vector<EscherContainerInfo> &children, EscherContainerInfo &out, const std::set<unsigned short> &types)
+{
+  for (const auto &child : children)
+  {
+    if (types.find(child.type) != types.end())
+    {
+      out = child;
+      return true;
+    }
+  }
+  return false;
+}
+
+FOPTValues MSPUBParser::extractFOPTValues(MSPUBMemoryStream *input, const EscherContainerInfo &record)
 {
   FOPTValues ret;
   input->seek(record.contentsOffset, librevenge::RVNG_SEEK_SET);
+  SpanReader data = readSpan(input, record.contentsLength);
   unsigned short numValues = record.initial >> 4;
-  std::vector<unsigned short> complexIds;
+  boost::container::small_vector<unsigned short, 8> complexIds;
   for (unsigned short i = 0; i < numValues; ++i)
   {
-    if (!stillReading(input, record.contentsOffset + record.contentsLength))
+    if (data.remaining() < 6)
     {
       break;
     }
-    unsigned short id = readU16(input);
-    unsigned value  = readU32(input);
-    ret.m_scalarValues[id] = value;
+    unsigned short id = data.readU16();
+    unsigned value  = data.readU32();
+    ret.m_scalarValues.set(id, value);
     bool complex = id & 0x8000;
     if (complex)
     {
@@ -2347,49 +2424,61 @@ FOPTValues MSPUBParser::extractFOPTValues(librevenge::RVNGInputStream *input, co
   }
   for (unsigned short id : complexIds)
   {
-    if (!stillReading(input, record.contentsOffset + record.contentsLength))
+    if (data.isEnd())
     {
       break;
     }
-    unsigned length = ret.m_scalarValues[id];
-    if (!length)
+    const unsigned *const length = ret.m_scalarValues.find(id);
+    if (!length || !*length)
     {
       continue;
     }
-    unsigned short numEntries = readU16(input);
-    input->seek(2, librevenge::RVNG_SEEK_CUR);
-    unsigned short entryLength = readU16(input);
+    const unsigned long start = data.tell() - record.contentsOffset;
+    unsigned short numEntries = data.readU16();
+    data.skip(2);
+    unsigned short entryLength = data.readU16();
     if (entryLength == 0xFFF0)
     {
       entryLength = 4;
     }
-    input->seek(-6, librevenge::RVNG_SEEK_CUR);
-    readNBytes(input, static_cast<unsigned long>(entryLength) * numEntries + 6, ret.m_complexValues[id]);
+    data.seekRelative(start);
+    const unsigned long complexLength = static_cast<unsigned long>(entryLength) * numEntries + 6;
+    if (complexLength > data.remaining())
+    {
+      ret.m_complexValues.set(id, ByteView());
+      break;
+    }
+    ret.m_complexValues.set(id, ByteView(data.current(), complexLength));
+    data.skip(complexLength);
   }
   return ret;
 }
 
-std::map<unsigned short, unsigned> MSPUBParser::extractEscherValues(librevenge::RVNGInputStream *input, const EscherContainerInfo &record)
+EscherValues MSPUBParser::extractEscherValues(MSPUBMemoryStream *input, const EscherContainerInfo &record)
 {
-  std::map<unsigned short, unsigned> ret;
-  input->seek(record.contentsOffset + getEscherElementAdditionalHeaderLength(record.type), librevenge::RVNG_SEEK_SET);
-  while (stillReading(input, record.contentsOffset + record.contentsLength))
+  EscherValues ret;
+  const unsigned additionalHeaderLength = getEscherElementAdditionalHeaderLength(record.type);
+  if (record.contentsLength <= additionalHeaderLength)
+    return ret;
+  input->seek(record.contentsOffset + additionalHeaderLength, librevenge::RVNG_SEEK_SET);
+  SpanReader data = readSpan(input, record.contentsLength - additionalHeaderLength);
+  while (!data.isEnd())
   {
-    unsigned short id = readU16(input);
+    unsigned short id = data.readU16();
     if (id == 0)
     {
-      if (!stillReading(input, record.contentsOffset + record.contentsLength))
+      if (data.isEnd())
         break;
       MSPUB_DEBUG_MSG(("found escher value with ID 0!\n"));
     }
-    unsigned value = readU32(input);
-    ret[id] = value;
+    unsigned value = data.readU32();
+    ret.set(id, value);
   }
   return ret;
 }
 
 
-bool MSPUBParser::parseContentChunkReference(librevenge::RVNGInputStream *input, const MSPUBBlockInfo block)
+bool MSPUBParser::parseContentChunkReference(MSPUBMemoryStream *input, const MSPUBBlockInfo block)
 {
   //input should be at block.dataOffset + 4 , that is, at the beginning of the list of sub-blocks
   MSPUB_DEBUG_MSG(("Parsing chunk reference 0x%x\n", m_lastSeenSeqNum));
@@ -2424,22 +2513,19 @@ bool MSPUBParser::parseContentChunkReference(librevenge::RVNGInputStream *input,
     if (type == PAGE)
     {
       MSPUB_DEBUG_MSG(("page chunk: offset 0x%lx, seqnum 0x%x\n", offset, m_lastSeenSeqNum));
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-      m_pageChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
+      m_pageChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0)));
       return true;
     }
     else if (type == DOCUMENT)
     {
       MSPUB_DEBUG_MSG(("document chunk: offset 0x%lx, seqnum 0x%x\n", offset, m_lastSeenSeqNum));
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-      m_documentChunkIndex = unsigned(m_contentChunks.size() - 1);
+      m_documentChunkIndex = addContentChunk(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
       return true;
     }
     else if (type == SHAPE || type == ALTSHAPE || type == GROUP || type == TABLE || type == LOGO)
     {
       MSPUB_DEBUG_MSG(("shape chunk: offset 0x%lx, seqnum 0x%x, parent seqnum: 0x%x\n", offset, m_lastSeenSeqNum, parentSeqNum));
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-      m_shapeChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
+      m_shapeChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0)));
       if (type == ALTSHAPE)
       {
         m_alternateShapeSeqNums.push_back(m_lastSeenSeqNum);
@@ -2448,104 +2534,172 @@ bool MSPUBParser::parseContentChunkReference(librevenge::RVNGInputStream *input,
     }
     else if (type == CELLS)
     {
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-      m_cellsChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
+      m_cellsChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0)));
       return true;
     }
     else if (type == PALETTE)
     {
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-      m_paletteChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
+      m_paletteChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0)));
       return true;
     }
     else if (type == BORDER_ART)
     {
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0,
-                                                      m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-      m_borderArtChunkIndices.push_back(
-        unsigned(m_contentChunks.size() - 1));
+      m_borderArtChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0,
+                                                      m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0)));
       return true;
     }
     else if (type == FONT)
     {
-      m_contentChunks.push_back(ContentChunkReference(type, offset, 0,
+      m_fontChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0,
                                                       m_lastSeenSeqNum,
-                                                      seenParentSeqNum ? parentSeqNum : 0));
-      m_fontChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
+                                                      seenParentSeqNum ? parentSeqNum : 0)));
       return true;
     }
-    m_contentChunks.push_back(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0));
-    m_unknownChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
+    m_unknownChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0, m_lastSeenSeqNum, seenParentSeqNum ? parentSeqNum : 0)));
+  }
+  return false;
+}
+
+unsigned MSPUBParser::addContentChunk(const ContentChunkReference &chunk)
+{
+  const unsigned index = unsigned(m_contentChunks.size());
+  m_contentChunks.push_back(chunk);
+  m_chunkIndicesBySeqNum.insert(std::make_pair(chunk.seqNum, index));
+  m_chunkChildIndicesBySeqNum[chunk.parentSeqNum].push_back(index);
+  return index;
+}
+
+const ContentChunkReference *MSPUBParser::findChunkBySeqNum(const unsigned seqNum, const MSPUBContentChunkType type) const
+{
+  const std::unordered_map<unsigned, unsigned>::const_iterator it = m_chunkIndicesBySeqNum.find(seqNum);
+  if (it == m_chunkIndicesBySeqNum.end() || m_contentChunks[it->second].type != type)
+    return nullptr;
+  return &m_contentChunks[it->second];
+}
+
+const std::vector<unsigned> &MSPUBParser::getChunkChildIndices(const unsigned parentSeqNum) const
+{
+  static const std::vector<unsigned> noChildren;
+  const std::unordered_map<unsigned, std::vector<unsigned> >::const_iterator it = m_chunkChildIndicesBySeqNum.find(parentSeqNum);
+  return it != m_chunkChildIndicesBySeqNum.end() ? it->second : noChildren;
+}
+
+bool MSPUBParser::isChunkSelected(const ContentChunkReference &chunk) const
+{
+  if (!m_selectedSeqNums)
+    return true;
+  const std::set<unsigned> &selected = get(m_selectedSeqNums);
+  if (selected.find(chunk.seqNum) != selected.end())
+    return true;
+  // shapes in groups and tables are only selected through their parent;
+  // the number of steps is bounded in case the parents form a cycle
+  unsigned parentSeqNum = chunk.parentSeqNum;
+  for (unsigned i = 0; i < m_contentChunks.size(); ++i)
+  {
+    if (selected.find(parentSeqNum) != selected.end())
+      return true;
+    const std::unordered_map<unsigned, unsigned>::const_iterator it = m_chunkIndicesBySeqNum.find(parentSeqNum);
+    if (it == m_chunkIndicesBySeqNum.end())
+      return false;
+    parentSeqNum = m_contentChunks[it->second].parentSeqNum;
   }
   return false;
 }
 
-bool MSPUBParser::isBlockDataString(unsigned type)
+bool MSPUBParser::isEscherShapeSelected(MSPUBMemoryStream *input, const EscherContainerInfo &shapeOrGroup)
 {
-  return type == STRING_CONTAINER;
+  if (!m_selectedSeqNums)
+    return true;
+  // a group has the seqnum of its first shape
+  EscherContainerInfo sp = shapeOrGroup;
+  input->seek(shapeOrGroup.contentsOffset, librevenge::RVNG_SEEK_SET);
+  bool selected = true;
+  if (shapeOrGroup.type == OFFICE_ART_SP_CONTAINER || findEscherContainer(input, shapeOrGroup, sp, OFFICE_ART_SP_CONTAINER))
+  {
+    EscherContainerInfo cData;
+    if (findEscherChild(readEscherChildren(input, sp), cData, OFFICE_ART_CLIENT_DATA))
+    {
+      const EscherValues dataValues = extractEscherValues(input, cData);
+      const unsigned *const shapeSeqNum = dataValues.find(FIELDID_SHAPE_ID);
+      // shapes without a seqnum, like the patriarch, are always kept
+      if (shapeSeqNum)
+        selected = get(m_selectedSeqNums).count(*shapeSeqNum) != 0;
+    }
+  }
+  input->seek(shapeOrGroup.contentsOffset, librevenge::RVNG_SEEK_SET);
+  return selected;
 }
-void MSPUBParser::skipBlock(librevenge::RVNGInputStream *input, MSPUBBlockInfo block)
+
+void MSPUBParser::skipBlock(MSPUBMemoryStream *input, MSPUBBlockInfo block)
 {
   input->seek(block.dataOffset + block.dataLength, librevenge::RVNG_SEEK_SET);
 }
 
-EscherContainerInfo MSPUBParser::parseEscherContainer(librevenge::RVNGInputStream *input)
+EscherContainerInfo MSPUBParser::parseEscherContainer(MSPUBMemoryStream *input)
 {
   EscherContainerInfo info;
-  info.initial = readU16(input);
-  info.type = readU16(input);
-  info.contentsLength = readU32(input);
-  info.contentsOffset = input->tell();
+  SpanReader header = readSpan(input, 8);
+  info.initial = header.readU16();
+  info.type = header.readU16();
+  info.contentsLength = header.readU32();
+  info.contentsOffset = header.tell();
   MSPUB_DEBUG_MSG(("Parsed escher container: type 0x%x, contentsOffset 0x%lx, contentsLength 0x%lx\n", info.type, info.contentsOffset, info.contentsLength));
   return info;
 }
 
-MSPUBBlockInfo MSPUBParser::parseBlock(librevenge::RVNGInputStream *input, bool skipHierarchicalData)
+MSPUBBlockInfo MSPUBParser::parseBlockHeader(MSPUBMemoryStream *input)
 {
   MSPUBBlockInfo info;
   info.startPosition = input->tell();
-  info.id = readU8(input);
-  info.type = readU8(input);
-  info.dataOffset = input->tell();
-  int len = getBlockDataLength(info.type);
-  bool varLen = len < 0;
-  if (varLen)
+  const unsigned char *const header = input->readExactly(2);
+  info.id = header[0];
+  info.type = header[1];
+  info.dataOffset = info.startPosition + 2;
+  const BlockDescriptor &descriptor = BLOCK_DESCRIPTORS[info.type];
+  if (descriptor.m_kind == BLOCK_UNKNOWN)
   {
-    info.dataLength = readU32(input);
-    if (isBlockDataString(info.type))
-    {
-      info.stringData = std::vector<unsigned char>();
-      readNBytes(input, info.dataLength - 4, info.stringData);
-    }
-    else if (skipHierarchicalData)
-    {
-      skipBlock(input, info);
-    }
-    info.data = 0;
+    MSPUB_DEBUG_MSG(("Block of unknown type seen!\n"));
   }
-  else
+  const unsigned char *const inlineData = input->readExactly(descriptor.m_inlineLength);
+  unsigned value = 0;
+  switch (descriptor.m_inlineLength)
   {
-    info.dataLength = len;
-    switch (info.dataLength)
-    {
-    case 1:
-      info.data = readU8(input);
-      break;
-    case 2:
-      info.data = readU16(input);
-      break;
-    case 4:
-      info.data = readU32(input);
-      break;
-    case 8:
-    case 16:
-    case 24:
-      //FIXME: Not doing anything with this data for now.
+  case 1:
+    value = inlineData[0];
+    break;
+  case 2:
+    value = decodeU16(inlineData);
+    break;
+  case 4:
+    value = decodeU32(inlineData);
+    break;
+  default:
+    break;
+  }
+  const bool hasLengthField = descriptor.m_kind == BLOCK_HIERARCHICAL || descriptor.m_kind == BLOCK_STRING;
+  info.dataLength = hasLengthField ? value : descriptor.m_dataLength;
+  info.data = hasLengthField ? 0 : value;
+  return info;
+}
+
+MSPUBBlockInfo MSPUBParser::parseBlock(MSPUBMemoryStream *input, bool skipHierarchicalData)
+{
+  MSPUBBlockInfo info = parseBlockHeader(input);
+  switch (BLOCK_DESCRIPTORS[info.type].m_kind)
+  {
+  case BLOCK_STRING:
+    readNBytes(input, info.dataLength - 4, info.stringData);
+    break;
+  case BLOCK_HIERARCHICAL:
+    if (skipHierarchicalData)
       skipBlock(input, info);
-      MSPUB_FALLTHROUGH;
-    default:
-      info.data = 0;
-    }
+    break;
+  case BLOCK_OPAQUE:
+    //FIXME: Not doing anything with this data for now.
+    skipBlock(input, info);
+    break;
+  default:
+    break;
   }
   MSPUB_DEBUG_MSG(("parseBlock dataOffset 0x%lx, id 0x%x, type 0x%x, dataLength 0x%lx, integral data 0x%x\n", info.dataOffset, info.id, info.type, info.dataLength, info.data));
   return info;
@@ -2565,7 +2719,7 @@ PageType MSPUBParser::getPageTypeBySeqNum(unsigned seqNum)
   }
 }
 
-bool MSPUBParser::parsePaletteChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk)
+bool MSPUBParser::parsePaletteChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk)
 {
   unsigned length = readU32(input);
   while (stillReading(input, chunk.offset + length))
@@ -2592,7 +2746,7 @@ bool MSPUBParser::parsePaletteChunk(librevenge::RVNGInputStream *input, const Co
   return true;
 }
 
-void MSPUBParser::parsePaletteEntry(librevenge::RVNGInputStream *input, MSPUBBlockInfo info)
+void MSPUBParser::parsePaletteEntry(MSPUBMemoryStream *input, MSPUBBlockInfo info)
 {
   while (stillReading(input, info.dataOffset + info.dataLength))
   {
@@ -11,17 +11,27 @@
 #define INCLUDED_MSPUBPARSER_H
 
 #include <map>
+#include <exception>
 #include <memory>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/optional.hpp>
 
 #include <librevenge/librevenge.h>
 
+#include "ColorReference.h"
+#include "EscherPropertyTable.h"
+#include "ImgInfo.h"
 #include "MSPUBTypes.h"
 #include "PolygonUtils.h"
+#include "ShapeType.h"
+#include "TableInfo.h"
+#include "VerticalAlign.h"
+#include "MSPUBDocumentContext.h"
+#include "MSPUBMemoryStream.h"
 
 namespace libmspub
 {
@@ -31,32 +41,10 @@ class MSPUBCollector;
 
 struct Coordinate;
 
-class FindBySeqNum
-{
-  unsigned seqNum;
-public:
-  FindBySeqNum(unsigned sn) : seqNum(sn) { }
-  bool operator()(const libmspub::ContentChunkReference &ref)
-  {
-    return ref.seqNum == seqNum;
-  }
-};
-
-class FindByParentSeqNum
-{
-  unsigned seqNum;
-public:
-  FindByParentSeqNum(unsigned sn) : seqNum(sn) { }
-  bool operator()(const libmspub::ContentChunkReference &ref)
-  {
-    return ref.parentSeqNum == seqNum;
-  }
-};
-
 struct FOPTValues
 {
-  std::map<unsigned short, unsigned> m_scalarValues;
-  std::map<unsigned short, std::vector<unsigned char> > m_complexValues;
+  EscherValues m_scalarValues;
+  EscherComplexValues m_complexValues;
   FOPTValues() : m_scalarValues(), m_complexValues()
   {
   }
@@ -65,7 +53,7 @@ struct FOPTValues
 class MSPUBParser
 {
 public:
-  explicit MSPUBParser(librevenge::RVNGInputStream *input, MSPUBCollector *collector);
+  explicit MSPUBParser(MSPUBDocumentContext *context, MSPUBCollector *collector);
   virtual ~MSPUBParser();
   virtual bool parse();
 protected:
@@ -87,68 +75,120 @@ protected:
     ParagraphStyle paraStyle;
   };
 
+  // What parseShape reads from a shape chunk, so that the chunks can be
+  // decoded concurrently and then applied to the collector in order.
+  struct ShapeChunkRecord
+  {
+    ShapeChunkRecord() : m_isValid(false), m_tableInfo(), m_textId(), m_borderImageId(),
+      m_stretchBorderArt(false), m_verticalAlign(), m_cropType(), m_exception() { }
+    bool m_isValid;
+    boost::optional<TableInfo> m_tableInfo;
+    boost::optional<unsigned> m_textId;
+    boost::optional<unsigned> m_borderImageId;
+    bool m_stretchBorderArt;
+    boost::optional<VerticalAlign> m_verticalAlign;
+    boost::optional<ShapeType> m_cropType;
+    std::exception_ptr m_exception;
+  };
+
+  struct QuillText
+  {
+    QuillText(unsigned id, unsigned offset) : m_id(id), m_offset(offset), m_paragraphs(), m_tableCellTextEnds() { }
+    unsigned m_id;
+    unsigned m_offset;
+    std::vector<TextParagraph> m_paragraphs;
+    boost::optional<std::vector<unsigned> > m_tableCellTextEnds;
+  };
+
+  // The Quill stream parsed without touching the collector, so that it can
+  // be read concurrently with the other streams.
+  struct ParsedQuill
+  {
+    ParsedQuill() : m_textColors(), m_fonts(), m_defaultCharStyles(), m_defaultParaStyles(), m_texts() { }
+    std::vector<ColorReference> m_textColors;
+    std::vector<std::vector<unsigned char> > m_fonts;
+    std::vector<CharacterStyle> m_defaultCharStyles;
+    std::vector<ParagraphStyle> m_defaultParaStyles;
+    std::vector<QuillText> m_texts;
+  };
+
   typedef std::vector<ContentChunkReference>::const_iterator ccr_iterator_t;
 
   MSPUBParser();
   MSPUBParser(const MSPUBParser &);
   MSPUBParser &operator=(const MSPUBParser &);
-  virtual bool parseContents(librevenge::RVNGInputStream *input);
+  virtual bool parseContents(MSPUBMemoryStream *input);
   bool parseMetaData();
-  bool parseQuill(librevenge::RVNGInputStream *input);
-  bool parseEscher(librevenge::RVNGInputStream *input);
-  bool parseEscherDelay(librevenge::RVNGInputStream *input);
-
-  MSPUBBlockInfo parseBlock(librevenge::RVNGInputStream *input, bool skipHierarchicalData = false);
-  EscherContainerInfo parseEscherContainer(librevenge::RVNGInputStream *input);
-
-  bool parseContentChunkReference(librevenge::RVNGInputStream *input, MSPUBBlockInfo block);
-  QuillChunkReference parseQuillChunkReference(librevenge::RVNGInputStream *input);
-  bool parseDocumentChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk);
-  bool parsePageChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk);
-  bool parsePaletteChunk(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk);
-  bool parsePageShapeList(librevenge::RVNGInputStream *input, MSPUBBlockInfo block, unsigned pageSeqNum);
-  bool parseShape(librevenge::RVNGInputStream *input, const ContentChunkReference &chunk);
-  bool parseBorderArtChunk(librevenge::RVNGInputStream *input,
+  bool parseQuill(MSPUBMemoryStream *input);
+  bool parseQuill(MSPUBMemoryStream *input, ParsedQuill &quill);
+  void applyQuill(const ParsedQuill &quill);
+  bool parseEscher(MSPUBMemoryStream *input);
+  // images of unknown type are kept as placeholders to preserve indices
+  void parseEscherDelay(MSPUBMemoryStream *input, std::vector<ImgInfo> &images);
+  void applyEscherDelay(const std::vector<ImgInfo> &images);
+
+  MSPUBBlockInfo parseBlock(MSPUBMemoryStream *input, bool skipHierarchicalData = false);
+  // reads the id, type and extent of a block and its integral data, if any;
+  // other data is left unread
+  MSPUBBlockInfo parseBlockHeader(MSPUBMemoryStream *input);
+  EscherContainerInfo parseEscherContainer(MSPUBMemoryStream *input);
+
+  bool parseContentChunkReference(MSPUBMemoryStream *input, MSPUBBlockInfo block);
+  unsigned addContentChunk(const ContentChunkReference &chunk);
+  const ContentChunkReference *findChunkBySeqNum(unsigned seqNum, MSPUBContentChunkType type) const;
+  const std::vector<unsigned> &getChunkChildIndices(unsigned parentSeqNum) const;
+  bool isChunkSelected(const ContentChunkReference &chunk) const;
+  bool isEscherShapeSelected(MSPUBMemoryStream *input, const EscherContainerInfo &shapeOrGroup);
+  QuillChunkReference parseQuillChunkReference(MSPUBMemoryStream *input);
+  bool parseDocumentChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk);
+  bool parsePageChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk);
+  bool parsePaletteChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk);
+  bool parsePageShapeList(MSPUBMemoryStream *input, MSPUBBlockInfo block, unsigned pageSeqNum);
+  bool parseShapeChunks(MSPUBMemoryStream *input);
+  // only reads input and the chunk indices, so it may run on any thread
+  bool decodeShapeChunk(MSPUBMemoryStream *input, const ContentChunkReference &chunk, ShapeChunkRecord &record);
+  void applyShapeChunk(const ContentChunkReference &chunk, const ShapeChunkRecord &record);
+  bool parseBorderArtChunk(MSPUBMemoryStream *input,
                            const ContentChunkReference &chunk);
-  bool parseFontChunk(librevenge::RVNGInputStream *input,
+  bool parseFontChunk(MSPUBMemoryStream *input,
                       const ContentChunkReference &chunk);
-  void parsePaletteEntry(librevenge::RVNGInputStream *input, MSPUBBlockInfo block);
-  void parseColors(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk);
-  void parseFonts(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk);
-  void parseDefaultStyle(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk);
-  void parseShapeGroup(librevenge::RVNGInputStream *input, const EscherContainerInfo &spgr, Coordinate parentCoordinateSystem, Coordinate parentGroupAbsoluteCoord);
-  void skipBlock(librevenge::RVNGInputStream *input, MSPUBBlockInfo block);
-  void parseEscherShape(librevenge::RVNGInputStream *input, const EscherContainerInfo &sp, Coordinate &parentCoordinateSystem, Coordinate &parentGroupAbsoluteCoord);
-  bool findEscherContainer(librevenge::RVNGInputStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, unsigned short type);
-  bool findEscherContainerWithTypeInSet(librevenge::RVNGInputStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, std::set<unsigned short> types);
-  std::map<unsigned short, unsigned> extractEscherValues(librevenge::RVNGInputStream *input, const EscherContainerInfo &record);
-  FOPTValues extractFOPTValues(librevenge::RVNGInputStream *input,
+  void parsePaletteEntry(MSPUBMemoryStream *input, MSPUBBlockInfo block);
+  void parseColors(MSPUBMemoryStream *input, const QuillChunkReference &chunk, ParsedQuill &quill);
+  void parseFonts(MSPUBMemoryStream *input, const QuillChunkReference &chunk, ParsedQuill &quill);
+  void parseDefaultStyle(MSPUBMemoryStream *input, const QuillChunkReference &chunk, ParsedQuill &quill);
+  void parseShapeGroup(MSPUBMemoryStream *input, const EscherContainerInfo &spgr, Coordinate parentCoordinateSystem, Coordinate parentGroupAbsoluteCoord, bool isTopLevel = false);
+  void skipBlock(MSPUBMemoryStream *input, MSPUBBlockInfo block);
+  void parseEscherShape(MSPUBMemoryStream *input, const EscherContainerInfo &sp, Coordinate &parentCoordinateSystem, Coordinate &parentGroupAbsoluteCoord);
+  bool findEscherContainer(MSPUBMemoryStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, unsigned short type);
+  bool findEscherContainerWithTypeInSet(MSPUBMemoryStream *input, const EscherContainerInfo &parent, EscherContainerInfo &out, std::set<unsigned short> types);
+  // reads the headers of all the children of a container in one pass
+  std::vector<EscherContainerInfo> readEscherChildren(MSPUBMemoryStream *input, const EscherContainerInfo &parent);
+  EscherValues extractEscherValues(MSPUBMemoryStream *input, const EscherContainerInfo &record);
+  FOPTValues extractFOPTValues(MSPUBMemoryStream *input,
                                const libmspub::EscherContainerInfo &record);
-  std::vector<TextSpanReference> parseCharacterStyles(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk);
-  std::vector<TextParagraphReference> parseParagraphStyles(librevenge::RVNGInputStream *input, const QuillChunkReference &chunk);
-  std::vector<Calculation> parseGuides(const std::vector<unsigned char>
-                                       &guideData);
-  std::vector<Vertex> parseVertices(const std::vector<unsigned char>
-                                    &vertexData);
-  std::vector<unsigned> parseTableCellDefinitions(librevenge::RVNGInputStream *input,
+  std::vector<TextSpanReference> parseCharacterStyles(MSPUBMemoryStream *input, const QuillChunkReference &chunk);
+  std::vector<TextParagraphReference> parseParagraphStyles(MSPUBMemoryStream *input, const QuillChunkReference &chunk);
+  std::vector<Calculation> parseGuides(const ByteView &guideData);
+  std::vector<Vertex> parseVertices(const ByteView &vertexData);
+  std::vector<unsigned> parseTableCellDefinitions(MSPUBMemoryStream *input,
                                                   const QuillChunkReference &chunk);
   std::vector<unsigned short> parseSegments(
-    const std::vector<unsigned char> &segmentData);
+    const ByteView &segmentData);
   DynamicCustomShape getDynamicCustomShape(
-    const std::vector<unsigned char> &vertexData,
-    const std::vector<unsigned char> &segmentData,
-    const std::vector<unsigned char> &guideData,
+    const ByteView &vertexData,
+    const ByteView &segmentData,
+    const ByteView &guideData,
     unsigned geoWidth, unsigned geoHeight);
-  int getColorIndex(librevenge::RVNGInputStream *input, const MSPUBBlockInfo &info);
-  unsigned getFontIndex(librevenge::RVNGInputStream *input, const MSPUBBlockInfo &info);
-  CharacterStyle getCharacterStyle(librevenge::RVNGInputStream *input);
-  ParagraphStyle getParagraphStyle(librevenge::RVNGInputStream *input);
-  std::shared_ptr<Fill> getNewFill(const std::map<unsigned short, unsigned> &foptProperties, bool &skipIfNotBg, std::map<unsigned short, std::vector<unsigned char> > &foptValues);
+  int getColorIndex(MSPUBMemoryStream *input, const MSPUBBlockInfo &info);
+  unsigned getFontIndex(MSPUBMemoryStream *input, const MSPUBBlockInfo &info);
+  CharacterStyle getCharacterStyle(MSPUBMemoryStream *input);
+  ParagraphStyle getParagraphStyle(MSPUBMemoryStream *input);
+  std::shared_ptr<Fill> getNewFill(const EscherValues &foptProperties, bool &skipIfNotBg, const EscherComplexValues &foptValues);
 
+  MSPUBDocumentContext *m_context;
   librevenge::RVNGInputStream *m_input;
   unsigned m_length;
   MSPUBCollector *m_collector;
-  std::vector<MSPUBBlockInfo> m_blockInfo;
   std::vector<ContentChunkReference> m_contentChunks;
   std::vector<unsigned> m_cellsChunkIndices;
   std::vector<unsigned> m_pageChunkIndices;
@@ -158,20 +198,26 @@ protected:
   std::vector<unsigned> m_fontChunkIndices;
   std::vector<unsigned> m_unknownChunkIndices;
   boost::optional<unsigned> m_documentChunkIndex;
+  // built by addContentChunk; the first chunk wins if seqnums repeat
+  std::unordered_map<unsigned, unsigned> m_chunkIndicesBySeqNum;
+  std::unordered_map<unsigned, std::vector<unsigned> > m_chunkChildIndicesBySeqNum;
   int m_lastSeenSeqNum;
   unsigned m_lastAddedImage;
   std::vector<int> m_alternateShapeSeqNums;
   std::vector<int> m_escherDelayIndices;
+  // with a page range: the seqnums of the selected pages and of the shapes
+  // on them; other shapes are only parsed if they belong to one of these
+  boost::optional<std::set<unsigned> > m_selectedSeqNums;
 
-  static short getBlockDataLength(unsigned type);
-  static bool isBlockDataString(unsigned type);
   static PageType getPageTypeBySeqNum(unsigned seqNum);
   static unsigned getEscherElementTailLength(unsigned short type);
   static unsigned getEscherElementAdditionalHeaderLength(unsigned short type);
   static ImgType imgTypeByBlipType(unsigned short type);
   static int getStartOffset(ImgType type, unsigned short initial);
-  static bool lineExistsByFlagPointer(unsigned *flags,
-                                      unsigned *geomFlags = nullptr);
+  static bool findEscherChild(const std::vector<EscherContainerInfo> &children, EscherContainerInfo &out, unsigned short type);
+  static bool findEscherChildWithTypeInSet(const std::vector<EscherContainerInfo> &children, EscherContainerInfo &out, const std::set<unsigned short> &types);
+  static bool lineExistsByFlagPointer(const unsigned *flags,
+                                      const unsigned *geomFlags = nullptr);
 };
 
 } // namespace libmspub
@@ -48,11 +48,10 @@ private:
 
 }
 
-MSPUBParser2k::MSPUBParser2k(librevenge::RVNGInputStream *input, MSPUBCollector *collector)
-  : MSPUBParser(input, collector),
+MSPUBParser2k::MSPUBParser2k(MSPUBDocumentContext *context, MSPUBCollector *collector)
+  : MSPUBParser(context, collector),
     m_imageDataChunkIndices(),
     m_quillColorEntries(),
-    m_chunkChildIndicesById(),
     m_chunksBeingRead()
 {
 }
@@ -340,11 +339,11 @@ ShapeType MSPUBParser2k::getShapeType(unsigned char shapeSpecifier)
   }
 }
 
-void MSPUBParser2k::parseContentsTextIfNecessary(librevenge::RVNGInputStream *)
+void MSPUBParser2k::parseContentsTextIfNecessary(MSPUBMemoryStream *)
 {
 }
 
-bool MSPUBParser2k::parseContents(librevenge::RVNGInputStream *input)
+bool MSPUBParser2k::parseContents(MSPUBMemoryStream *input)
 {
   parseContentsTextIfNecessary(input);
   input->seek(0x16, librevenge::RVNG_SEEK_SET);
@@ -370,27 +369,19 @@ bool MSPUBParser2k::parseContents(librevenge::RVNGInputStream *input)
     {
     case 0x0014:
       MSPUB_DEBUG_MSG(("Found page chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(PAGE, chunkOffset, 0, id, parent));
-      m_pageChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_pageChunkIndices.push_back(addContentChunk(ContentChunkReference(PAGE, chunkOffset, 0, id, parent)));
       break;
     case 0x0015:
       MSPUB_DEBUG_MSG(("Found document chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(DOCUMENT, chunkOffset, 0, id, parent));
-      m_documentChunkIndex = unsigned(m_contentChunks.size() - 1);
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_documentChunkIndex = addContentChunk(ContentChunkReference(DOCUMENT, chunkOffset, 0, id, parent));
       break;
     case 0x0002:
       MSPUB_DEBUG_MSG(("Found image_2k chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(IMAGE_2K, chunkOffset, 0, id, parent));
-      m_shapeChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_shapeChunkIndices.push_back(addContentChunk(ContentChunkReference(IMAGE_2K, chunkOffset, 0, id, parent)));
       break;
     case 0x0021:
       MSPUB_DEBUG_MSG(("Found image_2k_data chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(IMAGE_2K_DATA, chunkOffset, 0, id, parent));
-      m_imageDataChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_imageDataChunkIndices.push_back(addContentChunk(ContentChunkReference(IMAGE_2K_DATA, chunkOffset, 0, id, parent)));
       break;
     case 0x0000:
     case 0x0004:
@@ -399,27 +390,19 @@ bool MSPUBParser2k::parseContents(librevenge::RVNGInputStream *input)
     case 0x0007:
     case 0x0008:
       MSPUB_DEBUG_MSG(("Found shape chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(SHAPE, chunkOffset, 0, id, parent));
-      m_shapeChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_shapeChunkIndices.push_back(addContentChunk(ContentChunkReference(SHAPE, chunkOffset, 0, id, parent)));
       break;
     case 0x0047:
       MSPUB_DEBUG_MSG(("Found palette chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(PALETTE, chunkOffset, 0, id, parent));
-      m_paletteChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_paletteChunkIndices.push_back(addContentChunk(ContentChunkReference(PALETTE, chunkOffset, 0, id, parent)));
       break;
     case 0x000F:
       MSPUB_DEBUG_MSG(("Found group chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(GROUP, chunkOffset, 0, id, parent));
-      m_shapeChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_shapeChunkIndices.push_back(addContentChunk(ContentChunkReference(GROUP, chunkOffset, 0, id, parent)));
       break;
     default:
       MSPUB_DEBUG_MSG(("Found unknown chunk of id 0x%x and parent 0x%x\n", id, parent));
-      m_contentChunks.push_back(ContentChunkReference(UNKNOWN_CHUNK, chunkOffset, 0, id, parent));
-      m_unknownChunkIndices.push_back(unsigned(m_contentChunks.size() - 1));
-      m_chunkChildIndicesById[parent].push_back(unsigned(m_contentChunks.size() - 1));
+      m_unknownChunkIndices.push_back(addContentChunk(ContentChunkReference(UNKNOWN_CHUNK, chunkOffset, 0, id, parent)));
       break;
     }
   }
@@ -461,7 +444,7 @@ bool MSPUBParser2k::parseContents(librevenge::RVNGInputStream *input)
       img.append(buf, howManyRead);
       toRead -= howManyRead;
     }
-    m_collector->addImage(++m_lastAddedImage, WMF, img);
+    m_collector->addImage(++m_lastAddedImage, ImgInfo(WMF, img));
   }
 
   for (unsigned int shapeChunkIndex : m_shapeChunkIndices)
@@ -472,7 +455,7 @@ bool MSPUBParser2k::parseContents(librevenge::RVNGInputStream *input)
   return true;
 }
 
-bool MSPUBParser2k::parseDocument(librevenge::RVNGInputStream *input)
+bool MSPUBParser2k::parseDocument(MSPUBMemoryStream *input)
 {
   if (bool(m_documentChunkIndex))
   {
@@ -487,23 +470,22 @@ bool MSPUBParser2k::parseDocument(librevenge::RVNGInputStream *input)
   return false;
 }
 
-void MSPUBParser2k::parseShapeRotation(librevenge::RVNGInputStream *input, bool isGroup, bool isLine,
-                                       unsigned seqNum, unsigned chunkOffset)
+void MSPUBParser2k::parseShapeRotation(SpanReader &shapeData, bool isGroup, bool isLine, unsigned seqNum)
 {
-  input->seek(chunkOffset + 4, librevenge::RVNG_SEEK_SET);
+  shapeData.seekRelative(4);
   // shape transforms are NOT compounded with group transforms. They are equal to what they would be
   // if the shape were not part of a group at all. This is different from how MSPUBCollector handles rotations;
   // we work around the issue by simply not setting the rotation of any group, thereby letting it default to zero.
   //
   // Furthermore, line rotations are redundant and need to be treated as zero.
-  unsigned short counterRotationInDegreeTenths = readU16(input);
+  unsigned short counterRotationInDegreeTenths = shapeData.readU16();
   if (!isGroup && !isLine)
   {
     m_collector->setShapeRotation(seqNum, 360. - double(counterRotationInDegreeTenths) / 10);
   }
 }
 
-bool MSPUBParser2k::parse2kShapeChunk(const ContentChunkReference &chunk, librevenge::RVNGInputStream *input,
+bool MSPUBParser2k::parse2kShapeChunk(const ContentChunkReference &chunk, MSPUBMemoryStream *input,
                                       boost::optional<unsigned> pageSeqNum, bool topLevelCall)
 {
   if (find(m_chunksBeingRead.begin(), m_chunksBeingRead.end(), chunk.seqNum) != m_chunksBeingRead.end())
@@ -514,24 +496,15 @@ bool MSPUBParser2k::parse2kShapeChunk(const ContentChunkReference &chunk, librev
   const ChunkNestingGuard guard(m_chunksBeingRead, chunk.seqNum);
 
   unsigned page = pageSeqNum.get_value_or(chunk.parentSeqNum);
-  input->seek(chunk.offset, librevenge::RVNG_SEEK_SET);
   if (topLevelCall)
   {
     // ignore non top level shapes
-    int i_page = -1;
-    for (unsigned int pageIndex : m_pageChunkIndices)
-    {
-      if (m_contentChunks.at(pageIndex).seqNum == chunk.parentSeqNum)
-      {
-        i_page = pageIndex;
-        break;
-      }
-    }
-    if (i_page == -1)
+    const ContentChunkReference *const pageChunk = findChunkBySeqNum(chunk.parentSeqNum, PAGE);
+    if (!pageChunk)
     {
       return false;
     }
-    if (getPageTypeBySeqNum(m_contentChunks[i_page].seqNum) != NORMAL)
+    if (getPageTypeBySeqNum(pageChunk->seqNum) != NORMAL)
     {
       return false;
     }
@@ -541,6 +514,8 @@ bool MSPUBParser2k::parse2kShapeChunk(const ContentChunkReference &chunk, librev
       m_collector->addPage(chunk.parentSeqNum);
     }
   }
+  input->seek(chunk.offset, librevenge::RVNG_SEEK_SET);
+  SpanReader shapeData = readSpan(input, SHAPE_DATA_LENGTH);
   m_collector->setShapePage(chunk.seqNum, page);
   m_collector->setShapeBorderPosition(chunk.seqNum, INSIDE_SHAPE); // This appears to be the only possibility for MSPUB2k
   bool isImage = false;
@@ -548,10 +523,10 @@ bool MSPUBParser2k::parse2kShapeChunk(const ContentChunkReference &chunk, librev
   bool isGroup = false;
   bool isLine = false;
   unsigned flagsOffset(0); // ? why was this changed from boost::optional ?
-  parseShapeType(input, chunk.seqNum, chunk.offset, isGroup, isLine, isImage, isRectangle, flagsOffset);
-  parseShapeRotation(input, isGroup, isLine, chunk.seqNum, chunk.offset);
-  parseShapeCoordinates(input, chunk.seqNum, chunk.offset);
-  parseShapeFlips(input, flagsOffset, chunk.seqNum, chunk.offset);
+  parseShapeType(shapeData, chunk.seqNum, isGroup, isLine, isImage, isRectangle, flagsOffset);
+  parseShapeRotation(shapeData, isGroup, isLine, chunk.seqNum);
+  parseShapeCoordinates(shapeData, chunk.seqNum);
+  parseShapeFlips(shapeData, flagsOffset, chunk.seqNum);
   if (isGroup)
   {
     return parseGroup(input, chunk.seqNum, page);
@@ -562,9 +537,9 @@ bool MSPUBParser2k::parse2kShapeChunk(const ContentChunkReference &chunk, librev
   }
   else
   {
-    parseShapeFill(input, chunk.seqNum, chunk.offset);
+    parseShapeFill(shapeData, chunk.seqNum);
   }
-  parseShapeLine(input, isRectangle, chunk.offset, chunk.seqNum);
+  parseShapeLine(shapeData, isRectangle, chunk.seqNum);
   m_collector->setShapeOrder(chunk.seqNum);
   return true;
 }
@@ -579,35 +554,30 @@ unsigned MSPUBParser2k::getShapeFillColorOffset() const
   return 0x22;
 }
 
-void MSPUBParser2k::parseShapeFill(librevenge::RVNGInputStream *input, unsigned seqNum, unsigned chunkOffset)
+void MSPUBParser2k::parseShapeFill(SpanReader &shapeData, unsigned seqNum)
 {
-  input->seek(chunkOffset + getShapeFillTypeOffset(), librevenge::RVNG_SEEK_SET);
-  unsigned char fillType = readU8(input);
+  shapeData.seekRelative(getShapeFillTypeOffset());
+  unsigned char fillType = shapeData.readU8();
   if (fillType == 2) // other types are gradients and patterns which are not implemented yet. 0 is no fill.
   {
-    input->seek(chunkOffset + getShapeFillColorOffset(), librevenge::RVNG_SEEK_SET);
-    unsigned fillColorReference = readU32(input);
+    shapeData.seekRelative(getShapeFillColorOffset());
+    unsigned fillColorReference = shapeData.readU32();
     unsigned translatedFillColorReference = translate2kColorReference(fillColorReference);
-    m_collector->setShapeFill(seqNum, std::shared_ptr<Fill>(new SolidFill(ColorReference(translatedFillColorReference), 1, m_collector)), false);
+    m_collector->setShapeFill(seqNum, std::shared_ptr<Fill>(new SolidFill(ColorReference(translatedFillColorReference), 1)), false);
   }
 }
 
-bool MSPUBParser2k::parseGroup(librevenge::RVNGInputStream *input, unsigned seqNum, unsigned page)
+bool MSPUBParser2k::parseGroup(MSPUBMemoryStream *input, unsigned seqNum, unsigned page)
 {
   bool retVal = true;
   m_collector->beginGroup();
   m_collector->setCurrentGroupSeqNum(seqNum);
-  const std::map<unsigned, std::vector<unsigned> >::const_iterator it = m_chunkChildIndicesById.find(seqNum);
-  if (it != m_chunkChildIndicesById.end())
+  for (unsigned int chunkChildIndex : getChunkChildIndices(seqNum))
   {
-    const std::vector<unsigned> &chunkChildIndices = it->second;
-    for (unsigned int chunkChildIndex : chunkChildIndices)
+    const ContentChunkReference &childChunk = m_contentChunks.at(chunkChildIndex);
+    if (childChunk.type == SHAPE || childChunk.type == GROUP)
     {
-      const ContentChunkReference &childChunk = m_contentChunks.at(chunkChildIndex);
-      if (childChunk.type == SHAPE || childChunk.type == GROUP)
-      {
-        retVal = retVal && parse2kShapeChunk(childChunk, input, page, false);
-      }
+      retVal = retVal && parse2kShapeChunk(childChunk, input, page, false);
     }
   }
   m_collector->endGroup();
@@ -616,29 +586,25 @@ bool MSPUBParser2k::parseGroup(librevenge::RVNGInputStream *input, unsigned seqN
 
 void MSPUBParser2k::assignShapeImgIndex(unsigned seqNum)
 {
-  int i_dataIndex = -1;
-  for (size_t j = 0; j < m_imageDataChunkIndices.size(); ++j)
+  for (unsigned int chunkChildIndex : getChunkChildIndices(seqNum))
   {
-    if (m_contentChunks.at(m_imageDataChunkIndices[j]).parentSeqNum == seqNum)
+    if (m_contentChunks.at(chunkChildIndex).type == IMAGE_2K_DATA)
     {
-      i_dataIndex = j;
+      // images are added in the order of their data chunks
+      const std::vector<unsigned>::const_iterator it = std::lower_bound(m_imageDataChunkIndices.begin(), m_imageDataChunkIndices.end(), chunkChildIndex);
+      m_collector->setShapeImgIndex(seqNum, unsigned(it - m_imageDataChunkIndices.begin()) + 1);
       break;
     }
   }
-  if (i_dataIndex >= 0)
-  {
-    m_collector->setShapeImgIndex(seqNum, i_dataIndex + 1);
-  }
 }
 
-void MSPUBParser2k::parseShapeCoordinates(librevenge::RVNGInputStream *input, unsigned seqNum,
-                                          unsigned chunkOffset)
+void MSPUBParser2k::parseShapeCoordinates(SpanReader &shapeData, unsigned seqNum)
 {
-  input->seek(chunkOffset + 6, librevenge::RVNG_SEEK_SET);
-  int xs = translateCoordinateIfNecessary(readS32(input));
-  int ys = translateCoordinateIfNecessary(readS32(input));
-  int xe = translateCoordinateIfNecessary(readS32(input));
-  int ye = translateCoordinateIfNecessary(readS32(input));
+  shapeData.seekRelative(6);
+  int xs = translateCoordinateIfNecessary(shapeData.readS32());
+  int ys = translateCoordinateIfNecessary(shapeData.readS32());
+  int xe = translateCoordinateIfNecessary(shapeData.readS32());
+  int ye = translateCoordinateIfNecessary(shapeData.readS32());
   m_collector->setShapeCoordinatesInEmu(seqNum, xs, ys, xe, ye);
 }
 
@@ -647,26 +613,24 @@ int MSPUBParser2k::translateCoordinateIfNecessary(int coordinate) const
   return coordinate;
 }
 
-void MSPUBParser2k::parseShapeFlips(librevenge::RVNGInputStream *input, unsigned flagsOffset, unsigned seqNum,
-                                    unsigned chunkOffset)
+void MSPUBParser2k::parseShapeFlips(SpanReader &shapeData, unsigned flagsOffset, unsigned seqNum)
 {
   if (flagsOffset)
   {
-    input->seek(chunkOffset + flagsOffset, librevenge::RVNG_SEEK_SET);
-    unsigned char flags = readU8(input);
+    shapeData.seekRelative(flagsOffset);
+    unsigned char flags = shapeData.readU8();
     bool flipV = flags & 0x1;
     bool flipH = flags & (0x2 | 0x10); // FIXME: this is a guess
     m_collector->setShapeFlip(seqNum, flipV, flipH);
   }
 }
 
-void MSPUBParser2k::parseShapeType(librevenge::RVNGInputStream *input,
-                                   unsigned seqNum, unsigned chunkOffset,
+void MSPUBParser2k::parseShapeType(SpanReader &shapeData, unsigned seqNum,
                                    bool &isGroup, bool &isLine, bool &isImage, bool &isRectangle,
                                    unsigned &flagsOffset)
 {
-  input->seek(chunkOffset, librevenge::RVNG_SEEK_SET);
-  unsigned short typeMarker = readU16(input);
+  shapeData.seekRelative(0);
+  unsigned short typeMarker = shapeData.readU16();
   if (typeMarker == 0x000f)
   {
     isGroup = true;
@@ -690,8 +654,8 @@ void MSPUBParser2k::parseShapeType(librevenge::RVNGInputStream *input,
   }
   else if (typeMarker == 0x0006)
   {
-    input->seek(chunkOffset + 0x31, librevenge::RVNG_SEEK_SET);
-    ShapeType shapeType = getShapeType(readU8(input));
+    shapeData.seekRelative(0x31);
+    ShapeType shapeType = getShapeType(shapeData.readU8());
     flagsOffset = 0x33;
     if (shapeType != UNKNOWN_SHAPE)
     {
@@ -706,8 +670,8 @@ void MSPUBParser2k::parseShapeType(librevenge::RVNGInputStream *input,
   {
     m_collector->setShapeType(seqNum, RECTANGLE);
     isRectangle = true;
-    input->seek(chunkOffset + getTextIdOffset(), librevenge::RVNG_SEEK_SET);
-    unsigned txtId = readU16(input);
+    shapeData.seekRelative(getTextIdOffset());
+    unsigned txtId = shapeData.readU16();
     m_collector->addTextShape(txtId, seqNum);
   }
 }
@@ -732,36 +696,35 @@ unsigned MSPUBParser2k::getSecondLineOffset() const
   return 0x35;
 }
 
-void MSPUBParser2k::parseShapeLine(librevenge::RVNGInputStream *input, bool isRectangle, unsigned offset,
-                                   unsigned seqNum)
+void MSPUBParser2k::parseShapeLine(SpanReader &shapeData, bool isRectangle, unsigned seqNum)
 {
-  input->seek(offset + getFirstLineOffset(), librevenge::RVNG_SEEK_SET);
-  unsigned short leftLineWidth = readU8(input);
+  shapeData.seekRelative(getFirstLineOffset());
+  unsigned short leftLineWidth = shapeData.readU8();
   bool leftLineExists = leftLineWidth != 0;
-  unsigned leftColorReference = readU32(input);
+  unsigned leftColorReference = shapeData.readU32();
   unsigned translatedLeftColorReference = translate2kColorReference(leftColorReference);
   if (isRectangle)
   {
-    input->seek(offset + getSecondLineOffset(), librevenge::RVNG_SEEK_SET);
-    unsigned char topLineWidth = readU8(input);
+    shapeData.seekRelative(getSecondLineOffset());
+    unsigned char topLineWidth = shapeData.readU8();
     bool topLineExists = topLineWidth != 0;
-    unsigned topColorReference = readU32(input);
+    unsigned topColorReference = shapeData.readU32();
     unsigned translatedTopColorReference = translate2kColorReference(topColorReference);
     m_collector->addShapeLine(seqNum, Line(ColorReference(translatedTopColorReference),
                                            translateLineWidth(topLineWidth) * EMUS_IN_INCH / (4 * POINTS_IN_INCH), topLineExists));
 
-    input->seek(1, librevenge::RVNG_SEEK_CUR);
-    unsigned char rightLineWidth = readU8(input);
+    shapeData.skip(1);
+    unsigned char rightLineWidth = shapeData.readU8();
     bool rightLineExists = rightLineWidth != 0;
-    unsigned rightColorReference = readU32(input);
+    unsigned rightColorReference = shapeData.readU32();
     unsigned translatedRightColorReference = translate2kColorReference(rightColorReference);
     m_collector->addShapeLine(seqNum, Line(ColorReference(translatedRightColorReference),
                                            translateLineWidth(rightLineWidth) * EMUS_IN_INCH / (4 * POINTS_IN_INCH), rightLineExists));
 
-    input->seek(1, librevenge::RVNG_SEEK_CUR);
-    unsigned char bottomLineWidth = readU8(input);
+    shapeData.skip(1);
+    unsigned char bottomLineWidth = shapeData.readU8();
     bool bottomLineExists = bottomLineWidth != 0;
-    unsigned bottomColorReference = readU32(input);
+    unsigned bottomColorReference = shapeData.readU32();
     unsigned translatedBottomColorReference = translate2kColorReference(bottomColorReference);
     m_collector->addShapeLine(seqNum, Line(ColorReference(translatedBottomColorReference),
                                            translateLineWidth(bottomLineWidth) * EMUS_IN_INCH / (4 * POINTS_IN_INCH), bottomLineExists));
@@ -772,29 +735,29 @@ void MSPUBParser2k::parseShapeLine(librevenge::RVNGInputStream *input, bool isRe
 
 bool MSPUBParser2k::parse()
 {
-  std::unique_ptr<librevenge::RVNGInputStream> contents(m_input->getSubStreamByName("Contents"));
+  MSPUBMemoryStream *const contents = m_context->getSubStream("Contents");
   if (!contents)
   {
     MSPUB_DEBUG_MSG(("Couldn't get contents stream.\n"));
     return false;
   }
-  if (!parseContents(contents.get()))
+  if (!parseContents(contents))
   {
     MSPUB_DEBUG_MSG(("Couldn't parse contents stream.\n"));
     return false;
   }
-  std::unique_ptr<librevenge::RVNGInputStream> quill(m_input->getSubStreamByName("Quill/QuillSub/CONTENTS"));
+  MSPUBMemoryStream *const quill = m_context->getSubStream("Quill/QuillSub/CONTENTS");
   if (!quill)
   {
     MSPUB_DEBUG_MSG(("Couldn't get quill stream.\n"));
     return false;
   }
-  if (!parseQuill(quill.get()))
+  if (!parseQuill(quill))
   {
     MSPUB_DEBUG_MSG(("Couldn't parse quill stream.\n"));
     return false;
   }
-  return m_collector->go();
+  return true;
 }
 
 PageType MSPUBParser2k::getPageTypeBySeqNum(unsigned seqNum)
@@ -22,32 +22,31 @@ namespace libmspub
 
 class MSPUBParser2k : public MSPUBParser
 {
+  // covers every fixed-offset field read from a 2k/97 shape chunk
+  static const unsigned SHAPE_DATA_LENGTH = 0x5A;
+
   static ShapeType getShapeType(unsigned char shapeSpecifier);
   std::vector<unsigned> m_imageDataChunkIndices;
   std::vector<unsigned> m_quillColorEntries;
-  std::map<unsigned, std::vector<unsigned> > m_chunkChildIndicesById;
   std::deque<unsigned> m_chunksBeingRead;
 
 protected:
   // helper functions
-  bool parse2kShapeChunk(const ContentChunkReference &chunk, librevenge::RVNGInputStream *input,
+  bool parse2kShapeChunk(const ContentChunkReference &chunk, MSPUBMemoryStream *input,
                          boost::optional<unsigned> pageSeqNum = boost::optional<unsigned>(),
                          bool topLevelCall = true);
-  void parseShapeLine(librevenge::RVNGInputStream *input, bool isRectangle, unsigned offset, unsigned seqNum);
-  void parseShapeType(librevenge::RVNGInputStream *input,
-                      unsigned seqNum, unsigned chunkOffset,
+  void parseShapeLine(SpanReader &shapeData, bool isRectangle, unsigned seqNum);
+  void parseShapeType(SpanReader &shapeData, unsigned seqNum,
                       bool &isGroup, bool &isLine, bool &isImage, bool &isRectangle,
                       unsigned &flagsOffset);
-  void parseShapeRotation(librevenge::RVNGInputStream *input, bool isGroup, bool isLine, unsigned seqNum,
-                          unsigned chunkOffset);
-  void parseShapeFlips(librevenge::RVNGInputStream *input, unsigned flagsOffset, unsigned seqNum,
-                       unsigned chunkOffset);
-  void parseShapeCoordinates(librevenge::RVNGInputStream *input, unsigned seqNum, unsigned chunkOffset);
-  bool parseGroup(librevenge::RVNGInputStream *input, unsigned seqNum, unsigned page);
+  void parseShapeRotation(SpanReader &shapeData, bool isGroup, bool isLine, unsigned seqNum);
+  void parseShapeFlips(SpanReader &shapeData, unsigned flagsOffset, unsigned seqNum);
+  void parseShapeCoordinates(SpanReader &shapeData, unsigned seqNum);
+  bool parseGroup(MSPUBMemoryStream *input, unsigned seqNum, unsigned page);
   void assignShapeImgIndex(unsigned seqNum);
-  void parseShapeFill(librevenge::RVNGInputStream *input, unsigned seqNum, unsigned chunkOffset);
-  bool parseContents(librevenge::RVNGInputStream *input) override;
-  virtual bool parseDocument(librevenge::RVNGInputStream *input);
+  void parseShapeFill(SpanReader &shapeData, unsigned seqNum);
+  bool parseContents(MSPUBMemoryStream *input) override;
+  virtual bool parseDocument(MSPUBMemoryStream *input);
   unsigned getColorIndexByQuillEntry(unsigned entry) override;
   virtual int translateCoordinateIfNecessary(int coordinate) const;
   virtual unsigned getFirstLineOffset() const;
@@ -60,9 +59,9 @@ protected:
   static Color getColorBy2kHex(unsigned hex);
   static unsigned translate2kColorReference(unsigned ref2k);
   static PageType getPageTypeBySeqNum(unsigned seqNum);
-  virtual void parseContentsTextIfNecessary(librevenge::RVNGInputStream *input);
+  virtual void parseContentsTextIfNecessary(MSPUBMemoryStream *input);
 public:
-  explicit MSPUBParser2k(librevenge::RVNGInputStream *input, MSPUBCollector *collector);
+  explicit MSPUBParser2k(MSPUBDocumentContext *context, MSPUBCollector *collector);
   bool parse() override;
   ~MSPUBParser2k() override;
 };
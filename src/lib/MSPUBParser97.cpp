@@ -21,8 +21,8 @@
 namespace libmspub
 {
 
-MSPUBParser97::MSPUBParser97(librevenge::RVNGInputStream *input, MSPUBCollector *collector)
-  : MSPUBParser2k(input, collector), m_isBanner(false)
+MSPUBParser97::MSPUBParser97(MSPUBDocumentContext *context, MSPUBCollector *collector)
+  : MSPUBParser2k(context, collector), m_isBanner(false)
 {
   m_collector->useEncodingHeuristic();
 }
@@ -39,21 +39,21 @@ unsigned MSPUBParser97::getTextIdOffset() const
 
 bool MSPUBParser97::parse()
 {
-  std::unique_ptr<librevenge::RVNGInputStream> contents(m_input->getSubStreamByName("Contents"));
+  MSPUBMemoryStream *const contents = m_context->getSubStream("Contents");
   if (!contents)
   {
     MSPUB_DEBUG_MSG(("Couldn't get contents stream.\n"));
     return false;
   }
-  if (!parseContents(contents.get()))
+  if (!parseContents(contents))
   {
     MSPUB_DEBUG_MSG(("Couldn't parse contents stream.\n"));
     return false;
   }
-  return m_collector->go();
+  return true;
 }
 
-bool MSPUBParser97::parseDocument(librevenge::RVNGInputStream *input)
+bool MSPUBParser97::parseDocument(MSPUBMemoryStream *input)
 {
   if (bool(m_documentChunkIndex))
   {
@@ -69,7 +69,7 @@ bool MSPUBParser97::parseDocument(librevenge::RVNGInputStream *input)
   return false;
 }
 
-void MSPUBParser97::parseContentsTextIfNecessary(librevenge::RVNGInputStream *input)
+void MSPUBParser97::parseContentsTextIfNecessary(MSPUBMemoryStream *input)
 {
   input->seek(0x12, librevenge::RVNG_SEEK_SET);
   input->seek(readU32(input), librevenge::RVNG_SEEK_SET);
@@ -149,7 +149,7 @@ void MSPUBParser97::parseContentsTextIfNecessary(librevenge::RVNGInputStream *in
 }
 
 std::vector<MSPUBParser97::SpanInfo97> MSPUBParser97::getSpansInfo(
-  librevenge::RVNGInputStream *input,
+  MSPUBMemoryStream *input,
   unsigned prop1Index, unsigned prop2Index, unsigned /* prop3Index */,
   unsigned /* prop3End */)
 {
@@ -196,7 +196,7 @@ std::vector<MSPUBParser97::SpanInfo97> MSPUBParser97::getSpansInfo(
 }
 
 CharacterStyle MSPUBParser97::readCharacterStyle(
-  librevenge::RVNGInputStream *input, unsigned length)
+  MSPUBMemoryStream *input, unsigned length)
 {
   CharacterStyle style;
 
@@ -237,7 +237,7 @@ CharacterStyle MSPUBParser97::readCharacterStyle(
   return style;
 }
 
-MSPUBParser97::TextInfo97 MSPUBParser97::getTextInfo(librevenge::RVNGInputStream *input, unsigned length)
+MSPUBParser97::TextInfo97 MSPUBParser97::getTextInfo(MSPUBMemoryStream *input, unsigned length)
 {
   length = std::min(length, m_length); // sanity check
   std::vector<unsigned char> chars;
@@ -44,7 +44,7 @@ class MSPUBParser97 : public MSPUBParser2k
 
   bool m_isBanner;
 
-  bool parseDocument(librevenge::RVNGInputStream *input) override;
+  bool parseDocument(MSPUBMemoryStream *input) override;
   int translateCoordinateIfNecessary(int coordinate) const override;
   unsigned getFirstLineOffset() const override;
   unsigned getSecondLineOffset() const override;
@@ -52,15 +52,15 @@ class MSPUBParser97 : public MSPUBParser2k
   unsigned getShapeFillColorOffset() const override;
   unsigned short getTextMarker() const override;
   unsigned getTextIdOffset() const override;
-  CharacterStyle readCharacterStyle(librevenge::RVNGInputStream *input,
+  CharacterStyle readCharacterStyle(MSPUBMemoryStream *input,
                                     unsigned length);
-  void parseContentsTextIfNecessary(librevenge::RVNGInputStream *input) override;
-  std::vector<SpanInfo97> getSpansInfo(librevenge::RVNGInputStream *input,
+  void parseContentsTextIfNecessary(MSPUBMemoryStream *input) override;
+  std::vector<SpanInfo97> getSpansInfo(MSPUBMemoryStream *input,
                                        unsigned prop1Index, unsigned prop2Index, unsigned prop3Index,
                                        unsigned prop3End);
-  TextInfo97 getTextInfo(librevenge::RVNGInputStream *input, unsigned length);
+  TextInfo97 getTextInfo(MSPUBMemoryStream *input, unsigned length);
 public:
-  MSPUBParser97(librevenge::RVNGInputStream *input, MSPUBCollector *collector);
+  MSPUBParser97(MSPUBDocumentContext *context, MSPUBCollector *collector);
   bool parse() override;
 };
 }
@@ -0,0 +1,151 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SHA256.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace libmspub
+{
+
+namespace
+{
+
+const uint32_t ROUND_CONSTANTS[64] =
+{
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline uint32_t rotateRight(const uint32_t value, const unsigned bits)
+{
+  return (value >> bits) | (value << (32 - bits));
+}
+
+}
+
+SHA256::SHA256()
+  : m_state(), m_block(), m_blockLength(0), m_length(0)
+{
+  const uint32_t initialState[8] =
+  {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+  };
+  std::memcpy(m_state, initialState, sizeof(m_state));
+}
+
+void SHA256::update(const unsigned char *data, unsigned long length)
+{
+  m_length += length;
+  if (m_blockLength != 0)
+  {
+    const unsigned long count = std::min<unsigned long>(length, sizeof(m_block) - m_blockLength);
+    std::memcpy(m_block + m_blockLength, data, count);
+    m_blockLength += unsigned(count);
+    data += count;
+    length -= count;
+    if (m_blockLength < sizeof(m_block))
+      return;
+    processBlock(m_block);
+    m_blockLength = 0;
+  }
+  for (; length >= sizeof(m_block); data += sizeof(m_block), length -= sizeof(m_block))
+    processBlock(data);
+  std::memcpy(m_block, data, length);
+  m_blockLength = unsigned(length);
+}
+
+SHA256::Digest SHA256::finish()
+{
+  const uint64_t lengthInBits = m_length * 8;
+  m_block[m_blockLength++] = 0x80;
+  if (m_blockLength > sizeof(m_block) - 8)
+  {
+    std::memset(m_block + m_blockLength, 0, sizeof(m_block) - m_blockLength);
+    processBlock(m_block);
+    m_blockLength = 0;
+  }
+  std::memset(m_block + m_blockLength, 0, sizeof(m_block) - 8 - m_blockLength);
+  for (unsigned i = 0; i < 8; ++i)
+    m_block[sizeof(m_block) - 1 - i] = (unsigned char)(lengthInBits >> (8 * i));
+  processBlock(m_block);
+
+  Digest digest;
+  for (unsigned i = 0; i < 8; ++i)
+  {
+    for (unsigned j = 0; j < 4; ++j)
+      digest[4 * i + j] = (unsigned char)(m_state[i] >> (24 - 8 * j));
+  }
+  return digest;
+}
+
+std::string SHA256::toHex(const Digest &digest)
+{
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  std::string hex;
+  hex.reserve(2 * digest.size());
+  for (const unsigned char byte : digest)
+  {
+    hex += HEX_DIGITS[byte >> 4];
+    hex += HEX_DIGITS[byte & 0xf];
+  }
+  return hex;
+}
+
+void SHA256::processBlock(const unsigned char *const block)
+{
+  uint32_t w[64];
+  for (unsigned i = 0; i < 16; ++i)
+    w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) | (uint32_t(block[4 * i + 2]) << 8) | block[4 * i + 3];
+  for (unsigned i = 16; i < 64; ++i)
+  {
+    const uint32_t s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    const uint32_t s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+
+  uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+  uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+  for (unsigned i = 0; i < 64; ++i)
+  {
+    const uint32_t s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+    const uint32_t choice = (e & f) ^ (~e & g);
+    const uint32_t t1 = h + s1 + choice + ROUND_CONSTANTS[i] + w[i];
+    const uint32_t s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+    const uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+    const uint32_t t2 = s0 + majority;
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
+  m_state[5] += f;
+  m_state[6] += g;
+  m_state[7] += h;
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,48 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_SHA256_H
+#define INCLUDED_SHA256_H
+
+#include <array>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+namespace libmspub
+{
+
+// SHA-256 (FIPS 180-4), computed incrementally.
+class SHA256
+{
+public:
+  typedef std::array<unsigned char, 32> Digest;
+
+  SHA256();
+
+  void update(const unsigned char *data, unsigned long length);
+  // The hash of everything passed to update(). The object must not be
+  // updated afterwards.
+  Digest finish();
+
+  static std::string toHex(const Digest &digest);
+
+private:
+  void processBlock(const unsigned char *block);
+
+  uint32_t m_state[8];
+  unsigned char m_block[64];
+  unsigned m_blockLength;
+  uint64_t m_length;
+};
+
+}
+
+#endif // INCLUDED_SHA256_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
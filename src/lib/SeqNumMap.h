@@ -0,0 +1,256 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_SEQNUMMAP_H
+#define INCLUDED_SEQNUMMAP_H
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace libmspub
+{
+
+/* A map keyed by seqnum or text id, with the part of the interface of the
+ * std::map it replaces that the model uses. These keys are small integers
+ * handed out in sequence, so values live in a vector indexed by key. A key
+ * far beyond the keys seen so far goes to a sparse map instead, so that a
+ * stray large key in a damaged file does not allocate a huge vector. Every
+ * sparse key is at least the size of the vector; when the vector grows over
+ * sparse keys, their values move into it. Iteration is in key order.
+ *
+ * Unlike with std::map, inserting a key may grow the vector, which moves
+ * the values: it invalidates all iterators, pointers and references into
+ * the map. Only take them once the keys are all in, as
+ * MSPUBCollector::go() does.
+ */
+template <typename T>
+class SeqNumMap
+{
+public:
+  typedef unsigned key_type;
+  typedef T mapped_type;
+  typedef std::pair<const unsigned, T> value_type;
+
+private:
+  typedef boost::optional<value_type> Slot;
+  typedef std::vector<Slot> Dense;
+  typedef std::map<unsigned, T> Sparse;
+
+  // the vector is grown to take key only if that keeps it at least a
+  // quarter full, or if it stays short anyway
+  static const unsigned MIN_DENSE_SIZE = 256;
+  static const unsigned MAX_DENSE_SPREAD = 4;
+
+  template <typename ValueT, typename DenseIt, typename SparseIt>
+  class Iterator
+  {
+    friend class SeqNumMap;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef ValueT value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef ValueT *pointer;
+    typedef ValueT &reference;
+
+    Iterator() : m_dense(), m_denseEnd(), m_sparse()
+    {
+    }
+    // iterator to const_iterator
+    template <typename OtherValueT, typename OtherDenseIt, typename OtherSparseIt>
+    Iterator(const Iterator<OtherValueT, OtherDenseIt, OtherSparseIt> &other)
+      : m_dense(other.m_dense), m_denseEnd(other.m_denseEnd), m_sparse(other.m_sparse)
+    {
+    }
+
+    reference operator*() const
+    {
+      if (m_dense != m_denseEnd)
+        return **m_dense;
+      return *m_sparse;
+    }
+    pointer operator->() const
+    {
+      return &**this;
+    }
+    Iterator &operator++()
+    {
+      if (m_dense != m_denseEnd)
+        skipAbsent(++m_dense);
+      else
+        ++m_sparse;
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator old(*this);
+      ++*this;
+      return old;
+    }
+    bool operator==(const Iterator &other) const
+    {
+      return m_dense == other.m_dense && m_sparse == other.m_sparse;
+    }
+    bool operator!=(const Iterator &other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    Iterator(DenseIt dense, DenseIt denseEnd, SparseIt sparse)
+      : m_dense(dense), m_denseEnd(denseEnd), m_sparse(sparse)
+    {
+      skipAbsent(m_dense);
+    }
+
+    void skipAbsent(DenseIt &it) const
+    {
+      while (it != m_denseEnd && !*it)
+        ++it;
+    }
+
+    template <typename, typename, typename> friend class Iterator;
+
+    DenseIt m_dense;
+    DenseIt m_denseEnd;
+    SparseIt m_sparse;
+  };
+
+public:
+  typedef Iterator<value_type, typename Dense::iterator, typename Sparse::iterator> iterator;
+  typedef Iterator<const value_type, typename Dense::const_iterator, typename Sparse::const_iterator> const_iterator;
+
+  SeqNumMap() : m_dense(), m_sparse(), m_denseCount(0)
+  {
+  }
+
+  iterator begin()
+  {
+    return iterator(m_dense.begin(), m_dense.end(), m_sparse.begin());
+  }
+  iterator end()
+  {
+    return iterator(m_dense.end(), m_dense.end(), m_sparse.end());
+  }
+  const_iterator begin() const
+  {
+    return const_iterator(m_dense.begin(), m_dense.end(), m_sparse.begin());
+  }
+  const_iterator end() const
+  {
+    return const_iterator(m_dense.end(), m_dense.end(), m_sparse.end());
+  }
+
+  iterator find(unsigned key)
+  {
+    if (key < m_dense.size())
+    {
+      const typename Dense::iterator it = m_dense.begin() + key;
+      return *it ? iterator(it, m_dense.end(), m_sparse.begin()) : end();
+    }
+    return iterator(m_dense.end(), m_dense.end(), m_sparse.find(key));
+  }
+  const_iterator find(unsigned key) const
+  {
+    if (key < m_dense.size())
+    {
+      const typename Dense::const_iterator it = m_dense.begin() + key;
+      return *it ? const_iterator(it, m_dense.end(), m_sparse.begin()) : end();
+    }
+    return const_iterator(m_dense.end(), m_dense.end(), m_sparse.find(key));
+  }
+  std::size_t count(unsigned key) const
+  {
+    return find(key) != end() ? 1 : 0;
+  }
+
+  T &operator[](unsigned key)
+  {
+    if (key < m_dense.size() && m_dense[key])
+      return m_dense[key]->second;
+    return insert(value_type(key, T())).first->second;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value)
+  {
+    const unsigned key = value.first;
+    if (key >= m_dense.size() && (key < MIN_DENSE_SIZE || key / MAX_DENSE_SPREAD <= m_denseCount))
+      growDense(key + 1);
+    if (key < m_dense.size())
+    {
+      const typename Dense::iterator it = m_dense.begin() + key;
+      const bool inserted = !*it;
+      if (inserted)
+      {
+        it->emplace(value);
+        ++m_denseCount;
+      }
+      return std::make_pair(iterator(it, m_dense.end(), m_sparse.begin()), inserted);
+    }
+    const std::pair<typename Sparse::iterator, bool> result = m_sparse.insert(value);
+    return std::make_pair(iterator(m_dense.end(), m_dense.end(), result.first), result.second);
+  }
+
+  std::size_t erase(unsigned key)
+  {
+    if (key < m_dense.size())
+    {
+      if (!m_dense[key])
+        return 0;
+      m_dense[key] = boost::none;
+      --m_denseCount;
+      return 1;
+    }
+    return m_sparse.erase(key);
+  }
+
+  std::size_t size() const
+  {
+    return m_denseCount + m_sparse.size();
+  }
+  bool empty() const
+  {
+    return size() == 0;
+  }
+  void clear()
+  {
+    m_dense.clear();
+    m_sparse.clear();
+    m_denseCount = 0;
+  }
+
+private:
+  void growDense(std::size_t size)
+  {
+    // grow geometrically, as push_back would
+    if (size < 2 * m_dense.size())
+      size = 2 * m_dense.size();
+    m_dense.resize(size);
+    while (!m_sparse.empty() && m_sparse.begin()->first < m_dense.size())
+    {
+      m_dense[m_sparse.begin()->first].emplace(*m_sparse.begin());
+      ++m_denseCount;
+      m_sparse.erase(m_sparse.begin());
+    }
+  }
+
+  Dense m_dense;
+  Sparse m_sparse;
+  std::size_t m_denseCount;
+};
+
+}
+
+#endif // INCLUDED_SEQNUMMAP_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
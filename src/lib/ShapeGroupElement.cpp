@@ -10,6 +10,7 @@
 #include "ShapeGroupElement.h"
 
 #include <algorithm>
+#include <cassert>
 
 #include "Coordinate.h"
 #include "MSPUBConstants.h"
@@ -17,7 +18,7 @@
 namespace libmspub
 {
 
-ShapeGroupElement::ShapeGroupElement(const std::shared_ptr<ShapeGroupElement> &parent, unsigned seqNum) : m_shapeInfo(), m_parent(parent), m_children(), m_seqNum(seqNum), m_transform()
+ShapeGroupElement::ShapeGroupElement(const std::shared_ptr<ShapeGroupElement> &parent, unsigned seqNum) : m_shapeInfo(nullptr), m_parent(parent), m_children(), m_seqNum(seqNum), m_transform()
 {
 }
 
@@ -35,7 +36,9 @@ std::shared_ptr<ShapeGroupElement> ShapeGroupElement::create(const std::shared_p
 
 void ShapeGroupElement::setShapeInfo(const ShapeInfo &shapeInfo)
 {
-  m_shapeInfo = shapeInfo;
+  // the emitter paints the geometry resolved here
+  assert(shapeInfo.m_geometryResolved);
+  m_shapeInfo = &shapeInfo;
 }
 
 void ShapeGroupElement::setTransform(const VectorTransformation2D &transform)
@@ -57,7 +60,14 @@ void ShapeGroupElement::visit(std::function<
                               (const ShapeInfo &info, const Coordinate &relativeTo, const VectorTransformation2D &foldedTransform, bool isGroup, const VectorTransformation2D &thisTransform)
                               > visitor, const Coordinate &relativeTo, const VectorTransformation2D &parentFoldedTransform) const
 {
-  const ShapeInfo info = m_shapeInfo.get_value_or(ShapeInfo());
+  // set up like the shapes of the model, so that painting it copies nothing
+  static const ShapeInfo noShapeInfo = []()
+  {
+    ShapeInfo shapeInfo;
+    shapeInfo.resolveGeometry();
+    return shapeInfo;
+  }();
+  const ShapeInfo &info = m_shapeInfo ? *m_shapeInfo : noShapeInfo;
   Coordinate coord = info.m_coordinates.get_value_or(Coordinate());
   double centerX = ((double)coord.m_xs + (double)coord.m_xe) / (2 * EMUS_IN_INCH);
   double centerY = ((double)coord.m_ys + (double)coord.m_ye) / (2 * EMUS_IN_INCH);
@@ -105,6 +115,11 @@ unsigned ShapeGroupElement::getSeqNum() const
   return m_seqNum;
 }
 
+const std::vector<std::shared_ptr<ShapeGroupElement>> &ShapeGroupElement::getChildren() const
+{
+  return m_children;
+}
+
 }
 
 /* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -26,7 +26,7 @@ struct Coordinate;
 
 class ShapeGroupElement
 {
-  boost::optional<ShapeInfo> m_shapeInfo;
+  const ShapeInfo *m_shapeInfo; // owned by the collector
   std::weak_ptr<ShapeGroupElement> m_parent;
   std::vector<std::shared_ptr<ShapeGroupElement>> m_children;
   unsigned m_seqNum;
@@ -39,6 +39,7 @@ public:
   ~ShapeGroupElement();
   static std::shared_ptr<ShapeGroupElement> create(const std::shared_ptr<ShapeGroupElement> &parent, unsigned seqNum = 0);
 
+  // shapeInfo is referenced, not copied, so it must outlive this element
   void setShapeInfo(const ShapeInfo &shapeInfo);
   void setup(std::function<void(ShapeGroupElement &self)> visitor);
   void visit(std::function<
@@ -53,6 +54,7 @@ public:
   void setSeqNum(unsigned seqNum);
   void setTransform(const VectorTransformation2D &transform);
   unsigned getSeqNum() const;
+  const std::vector<std::shared_ptr<ShapeGroupElement>> &getChildren() const;
 };
 }
 
@@ -0,0 +1,169 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ShapeGuides.h"
+
+#include <algorithm>
+#include <math.h>
+
+#include "libmspub_utils.h"
+
+namespace libmspub
+{
+
+namespace
+{
+
+double applyGuideOp(int op, double valOne, double valTwo, double valThree)
+{
+  switch (op)
+  {
+  case 0:
+  case 14:
+    return valOne + valTwo - valThree;
+  case 1:
+    return valOne * valTwo / (valThree == 0 ? 1 : valThree);
+  case 2:
+    return (valOne + valTwo) / 2;
+  case 3:
+    return fabs(valOne);
+  case 4:
+    return std::min(valOne, valTwo);
+  case 5:
+    return std::max(valOne, valTwo);
+  case 6:
+    return valOne ? valTwo : valThree;
+  case 7:
+    return sqrt(valOne * valTwo * valThree);
+  case 8:
+    return atan2(valTwo, valOne) / (M_PI / 180);
+  case 9:
+    return valOne * sin(valTwo * (M_PI / 180));
+  case 10:
+    return valOne * cos(valTwo * (M_PI / 180));
+  case 11:
+    return valOne * cos(atan2(valThree, valTwo));
+  case 12:
+    return valOne * sin(atan2(valThree, valTwo));
+  case 13:
+    return sqrt(valOne);
+  case 15:
+    return valThree * sqrt(1 - (valOne / valTwo) * (valOne / valTwo));
+  case 16:
+    return valOne * tan(valTwo);
+  case 0x80:
+    return sqrt(valThree * valThree - valOne * valOne);
+  case 0x81:
+    return (cos(valThree * (M_PI / 180)) * (valOne - 10800) + sin(valThree * (M_PI / 180)) * (valTwo - 10800)) + 10800;
+  case 0x82:
+    return -(sin(valThree * (M_PI / 180)) * (valOne - 10800) - cos(valThree * (M_PI / 180)) * (valTwo - 10800)) + 10800;
+  default:
+    return 0;
+  }
+}
+
+}
+
+CompiledGuides::CompiledGuides(const CustomShape &shape)
+  : m_steps(), m_numGuides(shape.m_numCalculations)
+{
+  m_steps.reserve(m_numGuides);
+  std::vector<VisitState> states(m_numGuides, NOT_VISITED);
+  for (unsigned i = 0; i < m_numGuides; ++i)
+    compileGuide(shape, i, states);
+}
+
+void CompiledGuides::compileGuide(const CustomShape &shape, const unsigned guide, std::vector<VisitState> &states)
+{
+  if (states[guide] != NOT_VISITED)
+    return;
+  states[guide] = VISITING;
+  const Calculation &c = shape.mp_calculations[guide];
+  Step step;
+  step.m_guide = guide;
+  step.m_op = c.m_flags & 0xFF;
+  step.m_args[0] = compileArg(shape, c.m_flags & 0x2000, c.m_argOne, states);
+  step.m_args[1] = compileArg(shape, c.m_flags & 0x4000, c.m_argTwo, states);
+  step.m_args[2] = compileArg(shape, c.m_flags & 0x8000, c.m_argThree, states);
+  m_steps.push_back(step);
+  states[guide] = VISITED;
+}
+
+CompiledGuides::Arg CompiledGuides::compileArg(const CustomShape &shape, const bool special, const int value, std::vector<VisitState> &states)
+{
+  Arg arg;
+  if (!special)
+  {
+    arg.m_constant = value;
+  }
+  else if (PROP_ADJUST_VAL_FIRST <= value && PROP_ADJUST_VAL_LAST >= value)
+  {
+    arg.m_kind = ARG_ADJUST_VALUE;
+    arg.m_index = value - PROP_ADJUST_VAL_FIRST;
+    arg.m_shifted = (shape.m_adjustShiftMask >> arg.m_index) & 0x1;
+  }
+  else if (value == ASPECT_RATIO)
+  {
+    arg.m_kind = ARG_ASPECT_RATIO;
+  }
+  else if (value & OTHER_CALC_VAL)
+  {
+    const unsigned guide = value & 0xff;
+    // references to missing guides, and ones that close a cycle, read as 0
+    if (guide < m_numGuides && states[guide] != VISITING)
+    {
+      compileGuide(shape, guide, states);
+      arg.m_kind = ARG_GUIDE;
+      arg.m_index = guide;
+    }
+  }
+  else if (value == PROP_GEO_RIGHT)
+  {
+    arg.m_constant = shape.m_coordWidth;
+  }
+  else if (value == PROP_GEO_BOTTOM)
+  {
+    arg.m_constant = shape.m_coordHeight;
+  }
+  return arg;
+}
+
+double CompiledGuides::getArgValue(const Arg &arg, const std::vector<int> &adjustValues, const double aspectRatio, const std::vector<double> &values) const
+{
+  switch (arg.m_kind)
+  {
+  case ARG_ADJUST_VALUE:
+    if (arg.m_index < adjustValues.size())
+      return arg.m_shifted ? adjustValues[arg.m_index] >> 16 : adjustValues[arg.m_index];
+    return 0;
+  case ARG_ASPECT_RATIO:
+    return aspectRatio;
+  case ARG_GUIDE:
+    return values[arg.m_index];
+  case ARG_CONSTANT:
+  default:
+    return arg.m_constant;
+  }
+}
+
+void CompiledGuides::evaluate(const std::vector<int> &adjustValues, const double aspectRatio, std::vector<double> &values) const
+{
+  values.assign(m_numGuides, 0);
+  for (const auto &step : m_steps)
+  {
+    values[step.m_guide] = applyGuideOp(step.m_op,
+                                        getArgValue(step.m_args[0], adjustValues, aspectRatio, values),
+                                        getArgValue(step.m_args[1], adjustValues, aspectRatio, values),
+                                        getArgValue(step.m_args[2], adjustValues, aspectRatio, values));
+  }
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,84 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_SHAPEGUIDES_H
+#define INCLUDED_SHAPEGUIDES_H
+
+#include <vector>
+
+#include "PolygonUtils.h"
+
+namespace libmspub
+{
+
+/* The guides (formulas) of a custom shape, compiled so that all of them can
+ * be evaluated in one pass: every guide comes after the guides it refers
+ * to. A reference that would close a cycle is found once, here, and reads
+ * as 0, so that guides can not recurse forever.
+ */
+class CompiledGuides
+{
+public:
+  explicit CompiledGuides(const CustomShape &shape);
+
+  // Sets values[i] to the value of guide i, for a shape instance with the
+  // given adjust values and aspect ratio.
+  void evaluate(const std::vector<int> &adjustValues, double aspectRatio, std::vector<double> &values) const;
+
+private:
+  enum ArgKind
+  {
+    ARG_CONSTANT,
+    ARG_ADJUST_VALUE,
+    ARG_ASPECT_RATIO,
+    ARG_GUIDE
+  };
+
+  struct Arg
+  {
+    ArgKind m_kind;
+    double m_constant;
+    unsigned m_index; // of the adjust value or guide
+    bool m_shifted; // adjust value is in 16.16 fixed point
+
+    Arg() : m_kind(ARG_CONSTANT), m_constant(0), m_index(0), m_shifted(false)
+    {
+    }
+  };
+
+  struct Step
+  {
+    unsigned m_guide;
+    int m_op;
+    Arg m_args[3];
+
+    Step() : m_guide(0), m_op(0), m_args()
+    {
+    }
+  };
+
+  enum VisitState
+  {
+    NOT_VISITED,
+    VISITING,
+    VISITED
+  };
+
+  void compileGuide(const CustomShape &shape, unsigned guide, std::vector<VisitState> &states);
+  Arg compileArg(const CustomShape &shape, bool special, int value, std::vector<VisitState> &states);
+  double getArgValue(const Arg &arg, const std::vector<int> &adjustValues, double aspectRatio, const std::vector<double> &values) const;
+
+  std::vector<Step> m_steps;
+  unsigned m_numGuides;
+};
+
+}
+
+#endif // INCLUDED_SHAPEGUIDES_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
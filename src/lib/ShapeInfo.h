@@ -10,6 +10,7 @@
 #ifndef INCLUDED_SHAPEINFO_H
 #define INCLUDED_SHAPEINFO_H
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -27,6 +28,7 @@
 #include "Margins.h"
 #include "PolygonUtils.h"
 #include "Shadow.h"
+#include "ShapeGuides.h"
 #include "ShapeType.h"
 #include "TableInfo.h"
 #include "VerticalAlign.h"
@@ -34,23 +36,16 @@
 namespace libmspub
 {
 void noop(const CustomShape *);
-struct ShapeInfo
+
+// The attributes that only some shapes have: borders, pictures, tables,
+// text columns, dashes, arrows, shadows, custom geometry.
+struct ShapeExtraInfo
 {
-  boost::optional<ShapeType> m_type;
   boost::optional<ShapeType> m_cropType;
-  boost::optional<unsigned> m_imgIndex;
   boost::optional<unsigned> m_borderImgIndex;
-  boost::optional<Coordinate> m_coordinates;
-  std::vector<Line> m_lines;
-  boost::optional<unsigned> m_pageSeqNum;
-  boost::optional<unsigned> m_textId;
   std::map<unsigned, int> m_adjustValuesByIndex;
   std::vector<int> m_adjustValues;
-  boost::optional<double> m_rotation;
-  boost::optional<std::pair<bool, bool> > m_flips;
-  boost::optional<Margins> m_margins;
   boost::optional<BorderPosition> m_borderPosition; // Irrelevant except for rectangular shapes
-  std::shared_ptr<const Fill> m_fill;
   boost::optional<DynamicCustomShape> m_customShape;
   bool m_stretchBorderArt;
   boost::optional<ColorReference> m_lineBackColor;
@@ -63,37 +58,167 @@ struct ShapeInfo
   boost::optional<VerticalAlign> m_verticalAlign;
   boost::optional<ColorReference> m_pictureRecolor;
   boost::optional<Shadow> m_shadow;
-  boost::optional<int> m_innerRotation;
   std::vector<libmspub::Vertex> m_clipPath;
   boost::optional<int> m_pictureBrightness;
   boost::optional<int> m_pictureContrast;
-  ShapeInfo() : m_type(), m_cropType(), m_imgIndex(), m_borderImgIndex(),
-    m_coordinates(), m_lines(), m_pageSeqNum(),
-    m_textId(), m_adjustValuesByIndex(), m_adjustValues(),
-    m_rotation(), m_flips(), m_margins(), m_borderPosition(),
-    m_fill(), m_customShape(), m_stretchBorderArt(false),
+  ShapeExtraInfo() : m_cropType(), m_borderImgIndex(),
+    m_adjustValuesByIndex(), m_adjustValues(), m_borderPosition(),
+    m_customShape(), m_stretchBorderArt(false),
     m_lineBackColor(), m_dash(), m_tableInfo(),
     m_numColumns(),
     m_columnSpacing(0), m_beginArrow(), m_endArrow(),
-    m_verticalAlign(), m_pictureRecolor(), m_shadow(), m_innerRotation(), m_clipPath(), m_pictureBrightness(), m_pictureContrast()
+    m_verticalAlign(), m_pictureRecolor(), m_shadow(), m_clipPath(), m_pictureBrightness(), m_pictureContrast()
+  {
+  }
+};
+
+/* The attributes of a shape. Those that every shape has, and that painting
+ * it always reads, are kept inline; the rest are in a ShapeExtraInfo that
+ * is only allocated for shapes that set one of them.
+ */
+struct ShapeInfo
+{
+  boost::optional<ShapeType> m_type;
+  boost::optional<unsigned> m_imgIndex;
+  boost::optional<Coordinate> m_coordinates;
+  std::vector<Line> m_lines;
+  boost::optional<unsigned> m_pageSeqNum;
+  boost::optional<unsigned> m_textId;
+  boost::optional<double> m_rotation;
+  boost::optional<std::pair<bool, bool> > m_flips;
+  boost::optional<Margins> m_margins;
+  std::shared_ptr<const Fill> m_fill;
+  boost::optional<int> m_innerRotation;
+  std::unique_ptr<ShapeExtraInfo> m_extra;
+  // Derived from the attributes above by resolveGeometry(), once they are
+  // all known. They are not copied, as a custom geometry points into
+  // m_extra of the shape it was resolved for.
+  std::shared_ptr<const CustomShape> m_resolvedCustomShape;
+  std::shared_ptr<const CompiledGuides> m_resolvedGuides;
+  std::vector<int> m_resolvedAdjustValues;
+  bool m_geometryResolved;
+  ShapeInfo() : m_type(), m_imgIndex(),
+    m_coordinates(), m_lines(), m_pageSeqNum(),
+    m_textId(), m_rotation(), m_flips(), m_margins(),
+    m_fill(), m_innerRotation(), m_extra(),
+    m_resolvedCustomShape(), m_resolvedGuides(), m_resolvedAdjustValues(), m_geometryResolved(false)
   {
   }
-  std::shared_ptr<const CustomShape> getCustomShape() const
+  ShapeInfo(const ShapeInfo &other) : m_type(other.m_type), m_imgIndex(other.m_imgIndex),
+    m_coordinates(other.m_coordinates), m_lines(other.m_lines), m_pageSeqNum(other.m_pageSeqNum),
+    m_textId(other.m_textId), m_rotation(other.m_rotation), m_flips(other.m_flips), m_margins(other.m_margins),
+    m_fill(other.m_fill), m_innerRotation(other.m_innerRotation),
+    m_extra(other.m_extra ? new ShapeExtraInfo(*other.m_extra) : nullptr),
+    m_resolvedCustomShape(), m_resolvedGuides(), m_resolvedAdjustValues(), m_geometryResolved(false)
   {
-    if (bool(m_customShape))
+#ifdef LIBMSPUB_COUNT_SHAPEINFO_COPIES
+    ++copyCount();
+#endif
+  }
+  ShapeInfo &operator=(const ShapeInfo &other)
+  {
+    if (this != &other)
+    {
+      ShapeInfo copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+  ShapeInfo(ShapeInfo &&other) = default;
+  ShapeInfo &operator=(ShapeInfo &&other) = default;
+
+#ifdef LIBMSPUB_COUNT_SHAPEINFO_COPIES
+  // The number of copies made so far; the model is built without copying
+  // shapes around, and emitting it should make none. Only counted in the
+  // build of the library that emittercopytest links.
+  static std::atomic<unsigned long> &copyCount()
+  {
+    static std::atomic<unsigned long> count(0);
+    return count;
+  }
+#endif
+
+  // all unset unless the shape has some extra attribute
+  const ShapeExtraInfo &getExtra() const
+  {
+    static const ShapeExtraInfo noExtra;
+    return m_extra ? *m_extra : noExtra;
+  }
+  ShapeExtraInfo &getOrCreateExtra()
+  {
+    if (!m_extra)
+      m_extra.reset(new ShapeExtraInfo());
+    return *m_extra;
+  }
+
+  // Computes the geometry, its compiled guides and the adjust values
+  // that painting the shape uses, so that every paint of it reuses them.
+  void resolveGeometry()
+  {
+    m_resolvedCustomShape = calculateCustomShape();
+    m_resolvedGuides.reset();
+    if (m_resolvedCustomShape)
+      m_resolvedGuides = std::make_shared<const CompiledGuides>(*m_resolvedCustomShape);
+    m_resolvedAdjustValues = calculateAdjustValues();
+    m_geometryResolved = true;
+  }
+  const std::shared_ptr<const CustomShape> &getCustomShape() const
+  {
+    return m_resolvedCustomShape;
+  }
+  // null if there is no custom shape
+  const std::shared_ptr<const CompiledGuides> &getGuides() const
+  {
+    return m_resolvedGuides;
+  }
+  // the default adjust values of the geometry, overridden by those set for
+  // the shape
+  const std::vector<int> &getAdjustValues() const
+  {
+    return m_resolvedAdjustValues;
+  }
+
+private:
+  std::shared_ptr<const CustomShape> calculateCustomShape() const
+  {
+    const ShapeExtraInfo &extra = getExtra();
+    if (bool(extra.m_customShape))
     {
-      return getFromDynamicCustomShape(m_customShape.get());
+      return getFromDynamicCustomShape(extra.m_customShape.get());
     }
-    if (bool(m_cropType))
+    if (bool(extra.m_cropType))
     {
       return std::shared_ptr<const CustomShape>(
-               libmspub::getCustomShape(m_cropType.get()),
+               libmspub::getCustomShape(extra.m_cropType.get()),
                std::function<void (const CustomShape *)>(noop));
     }
     return std::shared_ptr<const CustomShape>(
              libmspub::getCustomShape(m_type.get_value_or(RECTANGLE)),
              std::function<void (const CustomShape *)>(noop));
   }
+  std::vector<int> calculateAdjustValues() const
+  {
+    std::vector<int> ret;
+    const ShapeExtraInfo &extra = getExtra();
+    if (m_resolvedCustomShape)
+    {
+      for (unsigned i = 0; i < m_resolvedCustomShape->m_numDefaultAdjustValues; ++i)
+      {
+        ret.push_back(m_resolvedCustomShape->mp_defaultAdjustValues[i]);
+      }
+    }
+    for (auto i = extra.m_adjustValuesByIndex.begin(); i != extra.m_adjustValuesByIndex.end(); ++i)
+    {
+      unsigned index = i->first;
+      int adjustVal = i->second;
+      for (unsigned j = extra.m_adjustValues.size(); j <= index; ++j)
+      {
+        ret.push_back(0);
+      }
+      ret[index] = adjustVal;
+    }
+    return ret;
+  }
 };
 }
 #endif
@@ -74,6 +74,35 @@ Vector2D VectorTransformation2D::transformWithOrigin(Vector2D v, Vector2D origin
   return transform(v - origin) + origin;
 }
 
+void VectorTransformation2D::transformWithOrigin(const double *const xs, const double *const ys, const std::size_t count, const Vector2D origin, double *const xsOut, double *const ysOut) const
+{
+  // The same arithmetic as for one point. Points are done in pairs, with
+  // all the loads before the stores, so that each pair can be computed in
+  // vector registers even though the arrays may overlap.
+  const double m11 = m_m11, m12 = m_m12, m21 = m_m21, m22 = m_m22;
+  const double tx = m_x, ty = m_y;
+  const double ox = origin.m_x, oy = origin.m_y;
+  std::size_t i = 0;
+  for (; i + 1 < count; i += 2)
+  {
+    const double x0 = xs[i] - ox;
+    const double x1 = xs[i + 1] - ox;
+    const double y0 = ys[i] - oy;
+    const double y1 = ys[i + 1] - oy;
+    xsOut[i] = m11 * x0 + m12 * y0 + tx + ox;
+    xsOut[i + 1] = m11 * x1 + m12 * y1 + tx + ox;
+    ysOut[i] = m21 * x0 + m22 * y0 + ty + oy;
+    ysOut[i + 1] = m21 * x1 + m22 * y1 + ty + oy;
+  }
+  if (i < count)
+  {
+    const double x = xs[i] - ox;
+    const double y = ys[i] - oy;
+    xsOut[i] = m11 * x + m12 * y + tx + ox;
+    ysOut[i] = m21 * x + m22 * y + ty + oy;
+  }
+}
+
 Vector2D operator+(const Vector2D &l, const Vector2D &r)
 {
   double x = l.m_x + r.m_x;
@@ -10,6 +10,8 @@
 #ifndef INCLUDED_VECTORTRANSFORMATION2D_H
 #define INCLUDED_VECTORTRANSFORMATION2D_H
 
+#include <cstddef>
+
 namespace libmspub
 {
 struct Vector2D
@@ -30,6 +32,8 @@ public:
   VectorTransformation2D();
   Vector2D transform(Vector2D original) const;
   Vector2D transformWithOrigin(Vector2D v, Vector2D origin) const;
+  // transformWithOrigin of count points, given as packed arrays of x and y
+  void transformWithOrigin(const double *xs, const double *ys, std::size_t count, Vector2D origin, double *xsOut, double *ysOut) const;
   double getRotation() const;
   double getHorizontalScaling() const;
   double getVerticalScaling() const;
@@ -0,0 +1,282 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace libmspub
+{
+
+struct ConcurrentTask::State
+{
+  explicit State(std::function<void()> task)
+    : m_task(std::move(task)), m_claimed(false), m_done(false), m_exception(), m_mutex(), m_doneCondition()
+  {
+  }
+
+  // Whoever claims the task first runs (or drops) it.
+  bool claim()
+  {
+    return !m_claimed.exchange(true);
+  }
+
+  void run()
+  {
+    try
+    {
+      m_task();
+    }
+    catch (...)
+    {
+      m_exception = std::current_exception();
+    }
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_done = true;
+    m_doneCondition.notify_all();
+  }
+
+  void waitDone()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this]()
+    {
+      return m_done;
+    });
+  }
+
+  const std::function<void()> m_task;
+  std::atomic<bool> m_claimed;
+  bool m_done;
+  std::exception_ptr m_exception;
+  std::mutex m_mutex;
+  std::condition_variable m_doneCondition;
+};
+
+namespace
+{
+
+// more would only cost memory
+const unsigned MAX_THREAD_COUNT = 256;
+
+unsigned readThreadCount()
+{
+  const char *const value = std::getenv("LIBMSPUB_THREADS");
+  if (!value || !*value)
+    return 1;
+  char *end = nullptr;
+  const unsigned long count = std::strtoul(value, &end, 10);
+  if (*end != '\0' || value[0] == '-')
+    return 1;
+  return unsigned(std::min<unsigned long>(count, MAX_THREAD_COUNT));
+}
+
+std::atomic<unsigned> &threadCountSetting()
+{
+  static std::atomic<unsigned> setting(readThreadCount());
+  return setting;
+}
+
+/* The threads that take up ConcurrentTasks. A task is queued for them, but
+ * whichever of a thread and the waiter claims it first runs it, so a task
+ * never waits for a busy or missing thread.
+ */
+class WorkerPool
+{
+public:
+  static WorkerPool &get()
+  {
+    static WorkerPool pool;
+    return pool;
+  }
+
+  ~WorkerPool()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_queueCondition.notify_all();
+    for (std::thread &thread : m_threads)
+      thread.join();
+  }
+
+  // Queues state, starting another thread if none is idle and there are
+  // fewer than maxThreads.
+  void submit(const std::shared_ptr<ConcurrentTask::State> &state, const unsigned maxThreads)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_queue.push_back(state);
+      if (m_idleCount < m_queue.size() && m_threads.size() < maxThreads)
+      {
+        try
+        {
+          m_threads.emplace_back(&WorkerPool::work, this);
+        }
+        catch (const std::system_error &)
+        {
+          // the waiter runs the task
+        }
+      }
+    }
+    m_queueCondition.notify_one();
+  }
+
+private:
+  WorkerPool()
+    : m_mutex(), m_queueCondition(), m_queue(), m_threads(), m_idleCount(0), m_stopping(false)
+  {
+  }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  void work()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+      ++m_idleCount;
+      m_queueCondition.wait(lock, [this]()
+      {
+        return m_stopping || !m_queue.empty();
+      });
+      --m_idleCount;
+      if (m_stopping)
+        return;
+      std::shared_ptr<ConcurrentTask::State> state = std::move(m_queue.front());
+      m_queue.pop_front();
+      lock.unlock();
+      if (state->claim())
+        state->run();
+      state.reset();
+      lock.lock();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_queueCondition;
+  std::deque<std::shared_ptr<ConcurrentTask::State> > m_queue;
+  std::vector<std::thread> m_threads;
+  std::size_t m_idleCount;
+  bool m_stopping;
+};
+
+} // anonymous namespace
+
+unsigned getThreadCount()
+{
+  const unsigned count = threadCountSetting();
+  if (count == 0)
+    return std::max(1u, std::min(std::thread::hardware_concurrency(), MAX_THREAD_COUNT));
+  return count;
+}
+
+void setThreadCount(const unsigned count)
+{
+  threadCountSetting() = std::min(count, MAX_THREAD_COUNT);
+}
+
+void parallelFor(const unsigned long count, const unsigned long minPerThread, const std::function<void(unsigned long)> &task)
+{
+  unsigned long threadCount = getThreadCount();
+  if (minPerThread > 0)
+    threadCount = std::min(threadCount, count / minPerThread);
+  if (threadCount <= 1)
+  {
+    for (unsigned long i = 0; i < count; ++i)
+      task(i);
+    return;
+  }
+
+  // Items are claimed in order and a claimed item is always finished, so
+  // when an item throws, all the items before it are done or under way.
+  std::atomic<unsigned long> next(0);
+  std::atomic<bool> failed(false);
+  std::mutex failureMutex;
+  unsigned long failedItem = count;
+  std::exception_ptr failure;
+  const std::function<void()> work = [&]()
+  {
+    while (!failed)
+    {
+      const unsigned long i = next++;
+      if (i >= count)
+        break;
+      try
+      {
+        task(i);
+      }
+      catch (...)
+      {
+        const std::lock_guard<std::mutex> lock(failureMutex);
+        if (i < failedItem)
+        {
+          failedItem = i;
+          failure = std::current_exception();
+        }
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<ConcurrentTask> helpers;
+  helpers.reserve(threadCount - 1);
+  for (unsigned long i = 1; i < threadCount; ++i)
+    helpers.emplace_back(work);
+  work();
+  for (ConcurrentTask &helper : helpers)
+    helper.wait();
+  if (failure)
+    std::rethrow_exception(failure);
+}
+
+ConcurrentTask::ConcurrentTask(std::function<void()> task)
+  : m_state(std::make_shared<State>(std::move(task)))
+{
+  const unsigned threadCount = getThreadCount();
+  if (threadCount > 1)
+    WorkerPool::get().submit(m_state, threadCount - 1);
+}
+
+ConcurrentTask::ConcurrentTask(ConcurrentTask &&other)
+  : m_state(std::move(other.m_state))
+{
+}
+
+ConcurrentTask::~ConcurrentTask()
+{
+  if (m_state && !m_state->claim())
+    m_state->waitDone();
+}
+
+void ConcurrentTask::wait()
+{
+  if (m_state->claim())
+    m_state->run();
+  else
+    m_state->waitDone();
+  if (m_state->m_exception)
+    std::rethrow_exception(m_state->m_exception);
+}
+
+} // namespace libmspub
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,66 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_WORKERPOOL_H
+#define INCLUDED_WORKERPOOL_H
+
+#include <functional>
+#include <memory>
+
+namespace libmspub
+{
+
+/* The parsers can spread their work over a pool of threads that is shared
+ * by all documents. The threads are started when a job first needs them
+ * and are kept for later jobs. How many threads work on a job, the calling
+ * thread included, is taken from the environment variable LIBMSPUB_THREADS,
+ * where 0 means one per core. It defaults to 1, i.e., unless asked to, the
+ * library starts no threads and does everything on the calling thread.
+ */
+unsigned getThreadCount();
+// Overrides LIBMSPUB_THREADS for the jobs started afterwards. Threads that
+// have already been started are kept, but jobs use no more than count.
+void setThreadCount(unsigned count);
+
+// Calls task(i) for every i < count, spread over the threads. No thread gets
+// fewer than minPerThread items, so small jobs run entirely on the calling
+// thread. If task throws, no further items are started and, once the
+// running ones are done, the exception of the lowest i is rethrown; so all
+// the items before it have been done, as they would be by a plain loop.
+void parallelFor(unsigned long count, unsigned long minPerThread, const std::function<void(unsigned long)> &task);
+
+/* Runs a task alongside the calling thread. If no thread of the pool takes
+ * it up, it is run by wait() instead. Destruction waits for a task that has
+ * been started, but drops one that has not, so that an exception thrown
+ * while the task is pending does not run it.
+ */
+class ConcurrentTask
+{
+public:
+  explicit ConcurrentTask(std::function<void()> task);
+  ConcurrentTask(ConcurrentTask &&other);
+  ~ConcurrentTask();
+
+  // Returns once the task is done, and rethrows its exception, if any.
+  void wait();
+
+  struct State;
+
+private:
+  ConcurrentTask(const ConcurrentTask &) = delete;
+  ConcurrentTask &operator=(const ConcurrentTask &) = delete;
+  ConcurrentTask &operator=(ConcurrentTask &&) = delete;
+
+  std::shared_ptr<State> m_state;
+};
+
+} // namespace libmspub
+
+#endif // INCLUDED_WORKERPOOL_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -9,6 +9,7 @@
 
 #include "libmspub_utils.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstring>
 #include <string.h> // for memcpy
@@ -19,6 +20,7 @@
 #include <zlib.h>
 
 #define ZLIB_CHUNK 16384
+#define ZLIB_MAX_RATIO 1032
 
 namespace libmspub
 {
@@ -164,11 +166,11 @@ unsigned correctModulo(int x, unsigned n) // returns the canonical representatio
   return x % n;
 }
 
-librevenge::RVNGBinaryData inflateData(librevenge::RVNGBinaryData deflated)
+librevenge::RVNGBinaryData inflateData(const unsigned char *const data, const unsigned long length, const unsigned long sizeHint)
 {
-  librevenge::RVNGBinaryData inflated;
-  unsigned char out[ZLIB_CHUNK];
-  const unsigned char *data = deflated.getDataBuffer();
+  if (!data || length == 0 || length > (uInt)-1)
+    return librevenge::RVNGBinaryData();
+
   z_stream strm;
   int ret;
   strm.zalloc = Z_NULL;
@@ -180,32 +182,41 @@ librevenge::RVNGBinaryData inflateData(librevenge::RVNGBinaryData deflated)
   {
     return librevenge::RVNGBinaryData();
   }
-  int have;
-  unsigned left = deflated.size();
+
+  // deflate can not compress better than about 1:1032, so anything above
+  // that comes from a corrupt header and must not be allocated up front
+  const unsigned long maxSize = length < ((unsigned long)-1) / ZLIB_MAX_RATIO ? length * ZLIB_MAX_RATIO : (unsigned long)-1;
+  std::vector<unsigned char> inflated(sizeHint && sizeHint <= maxSize ? sizeHint : std::min(maxSize, std::max<unsigned long>(4 * length, ZLIB_CHUNK)));
+  strm.avail_in = (uInt)length;
+  strm.next_in = (Bytef *)data;
+  unsigned long have = 0;
   do
   {
-    strm.avail_in = ZLIB_CHUNK > left ? left : ZLIB_CHUNK;
-    strm.next_in = (unsigned char *)data;
-    do
+    if (have == inflated.size())
     {
-      strm.avail_out = ZLIB_CHUNK;
-      strm.next_out = out;
-      ret = inflate(&strm, Z_NO_FLUSH);
-      if (ret < 0 || ret == Z_NEED_DICT)
+      // the hint was too small (or missing): grow geometrically
+      if (inflated.size() >= maxSize)
       {
         inflateEnd(&strm);
         return librevenge::RVNGBinaryData();
       }
-      have = ZLIB_CHUNK - strm.avail_out;
-      inflated.append(out, have);
+      inflated.resize(std::min(maxSize, 2 * inflated.size()));
+    }
+    const unsigned long avail = std::min<unsigned long>(inflated.size() - have, (uInt)-1);
+    strm.avail_out = (uInt)avail;
+    strm.next_out = inflated.data() + have;
+    ret = inflate(&strm, Z_NO_FLUSH);
+    have += avail - strm.avail_out;
+    if (ret == Z_NEED_DICT || (ret < 0 && ret != Z_BUF_ERROR) || (ret == Z_BUF_ERROR && strm.avail_in == 0))
+    {
+      // corrupt or truncated data
+      inflateEnd(&strm);
+      return librevenge::RVNGBinaryData();
     }
-    while (strm.avail_out == 0);
-    data += ZLIB_CHUNK > left ? left : ZLIB_CHUNK;
-    left -= ZLIB_CHUNK > left ? left : ZLIB_CHUNK;
   }
   while (ret != Z_STREAM_END);
   inflateEnd(&strm);
-  return inflated;
+  return librevenge::RVNGBinaryData(inflated.data(), have);
 }
 
 namespace
@@ -265,37 +276,43 @@ static void _appendUCS4(librevenge::RVNGString &text, unsigned ucs4Character)
 
 uint8_t readU8(librevenge::RVNGInputStream *input)
 {
-  if (!input || input->isEnd())
-  {
-    MSPUB_DEBUG_MSG(("Something bad happened here!"));
-    if (input)
-    {
-      MSPUB_DEBUG_MSG((" Tell: %ld\n", input->tell()));
-    }
-    throw EndOfStreamException();
-  }
-  unsigned long numBytesRead;
-  uint8_t const *p = input->read(sizeof(uint8_t), numBytesRead);
+  unsigned long numBytesRead = 0;
+  uint8_t const *p = input ? input->read(sizeof(uint8_t), numBytesRead) : nullptr;
 
   if (p && numBytesRead == sizeof(uint8_t))
     return *(uint8_t const *)(p);
+  MSPUB_DEBUG_MSG(("Something bad happened here!"));
+  if (input)
+  {
+    MSPUB_DEBUG_MSG((" Tell: %ld\n", input->tell()));
+  }
   throw EndOfStreamException();
 }
 
+namespace
+{
+
+const unsigned char *readExactly(librevenge::RVNGInputStream *input, unsigned long length)
+{
+  if (!input)
+    throw EndOfStreamException();
+  unsigned long numBytesRead = 0;
+  const unsigned char *p = input->read(length, numBytesRead);
+  if (!p || numBytesRead != length)
+    throw EndOfStreamException();
+  return p;
+}
+
+}
+
 uint16_t readU16(librevenge::RVNGInputStream *input)
 {
-  auto p0 = (uint16_t)readU8(input);
-  auto p1 = (uint16_t)readU8(input);
-  return (uint16_t)(p0|(p1<<8));
+  return decodeU16(readExactly(input, sizeof(uint16_t)));
 }
 
 uint32_t readU32(librevenge::RVNGInputStream *input)
 {
-  auto p0 = (uint32_t)readU8(input);
-  auto p1 = (uint32_t)readU8(input);
-  auto p2 = (uint32_t)readU8(input);
-  auto p3 = (uint32_t)readU8(input);
-  return (uint32_t)(p0|(p1<<8)|(p2<<16)|(p3<<24));
+  return decodeU32(readExactly(input, sizeof(uint32_t)));
 }
 
 int8_t readS8(librevenge::RVNGInputStream *input)
@@ -315,15 +332,17 @@ int32_t readS32(librevenge::RVNGInputStream *input)
 
 uint64_t readU64(librevenge::RVNGInputStream *input)
 {
-  auto p0 = (uint64_t)readU8(input);
-  auto p1 = (uint64_t)readU8(input);
-  auto p2 = (uint64_t)readU8(input);
-  auto p3 = (uint64_t)readU8(input);
-  auto p4 = (uint64_t)readU8(input);
-  auto p5 = (uint64_t)readU8(input);
-  auto p6 = (uint64_t)readU8(input);
-  auto p7 = (uint64_t)readU8(input);
-  return (uint64_t)(p0|(p1<<8)|(p2<<16)|(p3<<24)|(p4<<32)|(p5<<40)|(p6<<48)|(p7<<56));
+  return decodeU64(readExactly(input, sizeof(uint64_t)));
+}
+
+SpanReader readSpan(librevenge::RVNGInputStream *input, unsigned long length)
+{
+  if (!input)
+    throw EndOfStreamException();
+  const long base = input->tell();
+  unsigned long numBytesRead = 0;
+  const unsigned char *p = length ? input->read(length, numBytesRead) : nullptr;
+  return SpanReader(p, numBytesRead, base < 0 ? 0 : (unsigned long)base);
 }
 
 void readNBytes(librevenge::RVNGInputStream *input, unsigned long length, std::vector<unsigned char> &out)
@@ -110,7 +110,133 @@ class GenericException
 {
 };
 
-librevenge::RVNGBinaryData inflateData(librevenge::RVNGBinaryData);
+inline uint16_t decodeU16(const unsigned char *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+inline uint32_t decodeU32(const unsigned char *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+inline uint64_t decodeU64(const unsigned char *p)
+{
+  return (uint64_t)decodeU32(p) | ((uint64_t)decodeU32(p + 4) << 32);
+}
+
+// Bounds-checked little-endian reader over a contiguous buffer. The buffer is
+// not owned; offsets reported by tell() are relative to the originating stream.
+class SpanReader
+{
+public:
+  SpanReader(const unsigned char *data, unsigned long length, unsigned long base = 0)
+    : m_data(data), m_length(data ? length : 0), m_pos(0), m_base(base)
+  {
+  }
+
+  uint8_t readU8()
+  {
+    require(1);
+    return m_data[m_pos++];
+  }
+  uint16_t readU16()
+  {
+    require(2);
+    const uint16_t value = decodeU16(m_data + m_pos);
+    m_pos += 2;
+    return value;
+  }
+  uint32_t readU32()
+  {
+    require(4);
+    const uint32_t value = decodeU32(m_data + m_pos);
+    m_pos += 4;
+    return value;
+  }
+  uint64_t readU64()
+  {
+    require(8);
+    const uint64_t value = decodeU64(m_data + m_pos);
+    m_pos += 8;
+    return value;
+  }
+  int8_t readS8()
+  {
+    return (int8_t)readU8();
+  }
+  int16_t readS16()
+  {
+    return (int16_t)readU16();
+  }
+  int32_t readS32()
+  {
+    return (int32_t)readU32();
+  }
+  // copies length bytes to out; clears out if fewer are left, like readNBytes
+  void readNBytes(unsigned long length, std::vector<unsigned char> &out)
+  {
+    if (length > remaining())
+    {
+      out.clear();
+      m_pos = m_length;
+      return;
+    }
+    out.assign(m_data + m_pos, m_data + m_pos + length);
+    m_pos += length;
+  }
+
+  void skip(unsigned long length)
+  {
+    require(length);
+    m_pos += length;
+  }
+  // position relative to the start of the span
+  void seekRelative(unsigned long pos)
+  {
+    if (pos > m_length)
+      throw EndOfStreamException();
+    m_pos = pos;
+  }
+  unsigned long tell() const
+  {
+    return m_base + m_pos;
+  }
+  unsigned long remaining() const
+  {
+    return m_length - m_pos;
+  }
+  // the unread bytes; there are remaining() of them
+  const unsigned char *current() const
+  {
+    return m_data + m_pos;
+  }
+  bool isEnd() const
+  {
+    return m_pos >= m_length;
+  }
+
+private:
+  void require(unsigned long length) const
+  {
+    if (m_length - m_pos < length)
+      throw EndOfStreamException();
+  }
+
+  const unsigned char *m_data;
+  unsigned long m_length;
+  unsigned long m_pos;
+  unsigned long m_base;
+};
+
+// Reads up to length bytes from the current position of input in one call.
+// The returned reader points into the stream's buffer, so it is only valid
+// until the next operation on input.
+SpanReader readSpan(librevenge::RVNGInputStream *input, unsigned long length);
+
+// Inflates raw deflate data in one pass. sizeHint is the expected size of
+// the result, if known; it is only trusted within the limits of deflate.
+librevenge::RVNGBinaryData inflateData(const unsigned char *data, unsigned long length, unsigned long sizeHint = 0);
 
 } // namespace libmspub
 
@@ -0,0 +1,165 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "BlockDecoders.h"
+
+#include <algorithm>
+
+#include "MSPUBBlockType.h"
+#include "libmspub_utils.h"
+
+namespace libmspub
+{
+
+short legacyBlockDataLength(unsigned type)
+{
+  switch (type)
+  {
+  case DUMMY:
+  case 0x5:
+  case 0x8:
+  case 0xa:
+    return 0;
+  case 0x10:
+  case 0x12:
+  case 0x18:
+  case 0x1a:
+  case 0x07:
+    return 2;
+  case 0x20:
+  case 0x22:
+  case 0x58:
+  case 0x68:
+  case 0x70:
+  case 0xb8:
+    return 4;
+  case 0x28:
+    return 8;
+  case 0x38:
+    return 16;
+  case 0x48:
+    return 24;
+  case STRING_CONTAINER:
+  case 0x80:
+  case 0x82:
+  case GENERAL_CONTAINER:
+  case 0x8a:
+  case 0x90:
+  case 0x98:
+  case 0xa0:
+    return -1;
+  }
+  return 0;
+}
+
+bool legacyIsBlockDataString(unsigned type)
+{
+  return type == STRING_CONTAINER;
+}
+
+MSPUBBlockInfo legacyParseBlock(MSPUBMemoryStream *input, bool skipHierarchicalData)
+{
+  MSPUBBlockInfo info;
+  info.startPosition = input->tell();
+  info.id = readU8(input);
+  info.type = readU8(input);
+  info.dataOffset = input->tell();
+  const int len = legacyBlockDataLength(info.type);
+  if (len < 0)
+    info.dataLength = readU32(input);
+  else
+    info.dataLength = len;
+  if (len < 0)
+  {
+    if (legacyIsBlockDataString(info.type))
+    {
+      info.stringData = std::vector<unsigned char>();
+      readNBytes(input, info.dataLength - 4, info.stringData);
+    }
+    else if (skipHierarchicalData)
+    {
+      input->seek(info.dataOffset + info.dataLength, librevenge::RVNG_SEEK_SET);
+    }
+    info.data = 0;
+  }
+  else
+  {
+    switch (info.dataLength)
+    {
+    case 1:
+      info.data = readU8(input);
+      break;
+    case 2:
+      info.data = readU16(input);
+      break;
+    case 4:
+      info.data = readU32(input);
+      break;
+    case 8:
+    case 16:
+    case 24:
+      input->seek(info.dataOffset + info.dataLength, librevenge::RVNG_SEEK_SET);
+      MSPUB_FALLTHROUGH;
+    default:
+      info.data = 0;
+    }
+  }
+  return info;
+}
+
+namespace
+{
+
+void appendBytes(std::vector<unsigned char> &out, unsigned value, unsigned length)
+{
+  for (unsigned i = 0; i < length; ++i)
+    out.push_back((unsigned char)(value >> (8 * i)));
+}
+
+} // anonymous namespace
+
+void appendBlock(std::vector<unsigned char> &out, unsigned char id, unsigned char type)
+{
+  out.push_back(id);
+  out.push_back(type);
+  const short length = legacyBlockDataLength(type);
+  if (length >= 0)
+  {
+    appendBytes(out, 0x04030201u * (id + 1), std::min<unsigned>(unsigned(length), 4));
+    for (short i = 4; i < length; ++i)
+      out.push_back((unsigned char)(i + id));
+  }
+  else if (legacyIsBlockDataString(type))
+  {
+    appendBytes(out, 4 + id % 7, 4);
+    for (unsigned i = 0; i < id % 7u; ++i)
+      out.push_back((unsigned char)('a' + i));
+  }
+  else
+  {
+    appendBytes(out, 4 + 4 + 6, 4);
+    appendBlock(out, id, 0x10);
+    appendBlock(out, id, 0x20);
+  }
+}
+
+std::vector<unsigned char> makeBlockStream(unsigned rounds)
+{
+  std::vector<unsigned char> out;
+  for (unsigned round = 0; round < rounds; ++round)
+  {
+    for (unsigned type = 0; type < 256; ++type)
+      appendBlock(out, (unsigned char)(round + type), (unsigned char)type);
+  }
+  return out;
+}
+
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,56 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_BLOCKDECODERS_H
+#define INCLUDED_BLOCKDECODERS_H
+
+#include <vector>
+
+#include "MSPUBMemoryStream.h"
+#include "MSPUBParser.h"
+#include "MSPUBTypes.h"
+
+namespace libmspub
+{
+
+/* The block decoder as it was before BLOCK_DESCRIPTORS, as the reference
+ * that the table is checked and timed against. Like
+ * MSPUBParser::parseBlock, it is compiled out of line, so that the two
+ * are timed alike.
+ */
+
+// -1 for variable-length block with the data length as the first DWORD
+short legacyBlockDataLength(unsigned type);
+bool legacyIsBlockDataString(unsigned type);
+MSPUBBlockInfo legacyParseBlock(MSPUBMemoryStream *input, bool skipHierarchicalData = false);
+
+// exposes the parser's own block decoder
+class TableBlockParser : public MSPUBParser
+{
+public:
+  TableBlockParser(MSPUBDocumentContext *context, MSPUBCollector *collector)
+    : MSPUBParser(context, collector)
+  {
+  }
+
+  using MSPUBParser::parseBlock;
+};
+
+/* Appends a block of the given type, laid out as the legacy decoder
+ * expects. Containers hold a 2-byte and a 4-byte block, so that they can be
+ * decoded without skipping them too.
+ */
+void appendBlock(std::vector<unsigned char> &out, unsigned char id, unsigned char type);
+// every block type once per round
+std::vector<unsigned char> makeBlockStream(unsigned rounds);
+
+}
+
+#endif // INCLUDED_BLOCKDECODERS_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,96 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_MEMORYINPUTSTREAM_H
+#define INCLUDED_MEMORYINPUTSTREAM_H
+
+#include <algorithm>
+#include <vector>
+
+#include <librevenge/librevenge.h>
+
+namespace libmspub
+{
+
+/* An unstructured stream over a byte vector, so that the tests do not
+ * need librevenge-stream.
+ */
+class MemoryInputStream : public librevenge::RVNGInputStream
+{
+public:
+  explicit MemoryInputStream(const std::vector<unsigned char> &data) : m_data(data), m_pos(0) { }
+
+  bool isStructured() override
+  {
+    return false;
+  }
+  unsigned subStreamCount() override
+  {
+    return 0;
+  }
+  const char *subStreamName(unsigned) override
+  {
+    return nullptr;
+  }
+  bool existsSubStream(const char *) override
+  {
+    return false;
+  }
+  librevenge::RVNGInputStream *getSubStreamByName(const char *) override
+  {
+    return nullptr;
+  }
+  librevenge::RVNGInputStream *getSubStreamById(unsigned) override
+  {
+    return nullptr;
+  }
+
+  const unsigned char *read(unsigned long numBytes, unsigned long &numBytesRead) override
+  {
+    numBytesRead = 0;
+    if (numBytes == 0 || m_pos >= m_data.size())
+      return nullptr;
+    numBytesRead = std::min<unsigned long>(numBytes, m_data.size() - m_pos);
+    const unsigned char *const data = m_data.data() + m_pos;
+    m_pos += numBytesRead;
+    return data;
+  }
+
+  int seek(long offset, librevenge::RVNG_SEEK_TYPE seekType) override
+  {
+    long pos = offset;
+    if (seekType == librevenge::RVNG_SEEK_CUR)
+      pos += long(m_pos);
+    else if (seekType == librevenge::RVNG_SEEK_END)
+      pos += long(m_data.size());
+    if (pos < 0 || (unsigned long)pos > m_data.size())
+      return -1;
+    m_pos = (unsigned long)pos;
+    return 0;
+  }
+
+  long tell() override
+  {
+    return long(m_pos);
+  }
+
+  bool isEnd() override
+  {
+    return m_pos >= m_data.size();
+  }
+
+private:
+  const std::vector<unsigned char> &m_data;
+  unsigned long m_pos;
+};
+
+}
+
+#endif // INCLUDED_MEMORYINPUTSTREAM_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,117 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_NOOPDRAWINGINTERFACE_H
+#define INCLUDED_NOOPDRAWINGINTERFACE_H
+
+#include <librevenge/librevenge.h>
+
+namespace libmspub
+{
+
+/* A painter that throws everything away, so that what is measured is the
+ * emission itself. It only counts pages, drawn objects and text runs.
+ */
+class NoopDrawingInterface : public librevenge::RVNGDrawingInterface
+{
+public:
+  NoopDrawingInterface() : m_pages(0), m_objects(0), m_texts(0) { }
+
+  unsigned m_pages;
+  unsigned m_objects;
+  unsigned m_texts;
+
+  void startDocument(const librevenge::RVNGPropertyList &) override { }
+  void endDocument() override { }
+  void setDocumentMetaData(const librevenge::RVNGPropertyList &) override { }
+  void defineEmbeddedFont(const librevenge::RVNGPropertyList &) override { }
+  void startPage(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_pages;
+  }
+  void endPage() override { }
+  void startMasterPage(const librevenge::RVNGPropertyList &) override { }
+  void endMasterPage() override { }
+  void setStyle(const librevenge::RVNGPropertyList &) override { }
+  void startLayer(const librevenge::RVNGPropertyList &) override { }
+  void endLayer() override { }
+  void startEmbeddedGraphics(const librevenge::RVNGPropertyList &) override { }
+  void endEmbeddedGraphics() override { }
+  void openGroup(const librevenge::RVNGPropertyList &) override { }
+  void closeGroup() override { }
+
+  void drawRectangle(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+  void drawEllipse(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+  void drawPolyline(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+  void drawPolygon(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+  void drawPath(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+  void drawGraphicObject(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+  void drawConnector(const librevenge::RVNGPropertyList &) override
+  {
+    ++m_objects;
+  }
+
+  void startTextObject(const librevenge::RVNGPropertyList &) override { }
+  void endTextObject() override { }
+  void startTableObject(const librevenge::RVNGPropertyList &) override { }
+  void openTableRow(const librevenge::RVNGPropertyList &) override { }
+  void closeTableRow() override { }
+  void openTableCell(const librevenge::RVNGPropertyList &) override { }
+  void closeTableCell() override { }
+  void insertCoveredTableCell(const librevenge::RVNGPropertyList &) override { }
+  void endTableObject() override { }
+
+  void insertTab() override { }
+  void insertSpace() override { }
+  void insertText(const librevenge::RVNGString &) override
+  {
+    ++m_texts;
+  }
+  void insertLineBreak() override { }
+  void insertField(const librevenge::RVNGPropertyList &) override { }
+
+  void openOrderedListLevel(const librevenge::RVNGPropertyList &) override { }
+  void openUnorderedListLevel(const librevenge::RVNGPropertyList &) override { }
+  void closeOrderedListLevel() override { }
+  void closeUnorderedListLevel() override { }
+  void openListElement(const librevenge::RVNGPropertyList &) override { }
+  void closeListElement() override { }
+
+  void defineParagraphStyle(const librevenge::RVNGPropertyList &) override { }
+  void openParagraph(const librevenge::RVNGPropertyList &) override { }
+  void closeParagraph() override { }
+  void defineCharacterStyle(const librevenge::RVNGPropertyList &) override { }
+  void openSpan(const librevenge::RVNGPropertyList &) override { }
+  void closeSpan() override { }
+  void openLink(const librevenge::RVNGPropertyList &) override { }
+  void closeLink() override { }
+};
+
+}
+
+#endif // INCLUDED_NOOPDRAWINGINTERFACE_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
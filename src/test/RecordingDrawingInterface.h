@@ -0,0 +1,257 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_RECORDINGDRAWINGINTERFACE_H
+#define INCLUDED_RECORDINGDRAWINGINTERFACE_H
+
+#include <string>
+
+#include <librevenge/librevenge.h>
+
+namespace libmspub
+{
+
+/* A painter that writes every call it gets, with its properties, into a
+ * string, so that the tests can check that two ways of producing a
+ * document draw the same.
+ */
+class RecordingDrawingInterface : public librevenge::RVNGDrawingInterface
+{
+public:
+  RecordingDrawingInterface() : m_output() { }
+
+  std::string m_output;
+
+  void startDocument(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startDocument", propList);
+  }
+  void endDocument() override
+  {
+    record("endDocument");
+  }
+  void setDocumentMetaData(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("setDocumentMetaData", propList);
+  }
+  void defineEmbeddedFont(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("defineEmbeddedFont", propList);
+  }
+  void startPage(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startPage", propList);
+  }
+  void endPage() override
+  {
+    record("endPage");
+  }
+  void startMasterPage(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startMasterPage", propList);
+  }
+  void endMasterPage() override
+  {
+    record("endMasterPage");
+  }
+  void setStyle(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("setStyle", propList);
+  }
+  void startLayer(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startLayer", propList);
+  }
+  void endLayer() override
+  {
+    record("endLayer");
+  }
+  void startEmbeddedGraphics(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startEmbeddedGraphics", propList);
+  }
+  void endEmbeddedGraphics() override
+  {
+    record("endEmbeddedGraphics");
+  }
+  void openGroup(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openGroup", propList);
+  }
+  void closeGroup() override
+  {
+    record("closeGroup");
+  }
+
+  void drawRectangle(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawRectangle", propList);
+  }
+  void drawEllipse(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawEllipse", propList);
+  }
+  void drawPolyline(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawPolyline", propList);
+  }
+  void drawPolygon(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawPolygon", propList);
+  }
+  void drawPath(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawPath", propList);
+  }
+  void drawGraphicObject(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawGraphicObject", propList);
+  }
+  void drawConnector(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("drawConnector", propList);
+  }
+
+  void startTextObject(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startTextObject", propList);
+  }
+  void endTextObject() override
+  {
+    record("endTextObject");
+  }
+  void startTableObject(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("startTableObject", propList);
+  }
+  void openTableRow(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openTableRow", propList);
+  }
+  void closeTableRow() override
+  {
+    record("closeTableRow");
+  }
+  void openTableCell(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openTableCell", propList);
+  }
+  void closeTableCell() override
+  {
+    record("closeTableCell");
+  }
+  void insertCoveredTableCell(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("insertCoveredTableCell", propList);
+  }
+  void endTableObject() override
+  {
+    record("endTableObject");
+  }
+
+  void insertTab() override
+  {
+    record("insertTab");
+  }
+  void insertSpace() override
+  {
+    record("insertSpace");
+  }
+  void insertText(const librevenge::RVNGString &text) override
+  {
+    m_output += "insertText(";
+    m_output += text.cstr();
+    m_output += ")\n";
+  }
+  void insertLineBreak() override
+  {
+    record("insertLineBreak");
+  }
+  void insertField(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("insertField", propList);
+  }
+
+  void openOrderedListLevel(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openOrderedListLevel", propList);
+  }
+  void openUnorderedListLevel(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openUnorderedListLevel", propList);
+  }
+  void closeOrderedListLevel() override
+  {
+    record("closeOrderedListLevel");
+  }
+  void closeUnorderedListLevel() override
+  {
+    record("closeUnorderedListLevel");
+  }
+  void openListElement(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openListElement", propList);
+  }
+  void closeListElement() override
+  {
+    record("closeListElement");
+  }
+
+  void defineParagraphStyle(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("defineParagraphStyle", propList);
+  }
+  void openParagraph(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openParagraph", propList);
+  }
+  void closeParagraph() override
+  {
+    record("closeParagraph");
+  }
+  void defineCharacterStyle(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("defineCharacterStyle", propList);
+  }
+  void openSpan(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openSpan", propList);
+  }
+  void closeSpan() override
+  {
+    record("closeSpan");
+  }
+  void openLink(const librevenge::RVNGPropertyList &propList) override
+  {
+    record("openLink", propList);
+  }
+  void closeLink() override
+  {
+    record("closeLink");
+  }
+
+private:
+  void record(const char *call)
+  {
+    m_output += call;
+    m_output += '\n';
+  }
+  void record(const char *call, const librevenge::RVNGPropertyList &propList)
+  {
+    m_output += call;
+    m_output += '(';
+    m_output += propList.getPropString().cstr();
+    m_output += ")\n";
+  }
+};
+
+}
+
+#endif // INCLUDED_RECORDINGDRAWINGINTERFACE_H
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
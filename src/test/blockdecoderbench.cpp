@@ -0,0 +1,110 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Times MSPUBParser::parseBlock against the switch-based decoder it
+ * replaced, on a synthetic Contents stream holding every known block type.
+ *
+ * usage: blockdecoderbench [rounds of all known types] [passes]
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "BlockDecoders.h"
+#include "MSPUBBlockDescriptor.h"
+#include "MSPUBCollector.h"
+#include "MSPUBDocumentContext.h"
+#include "MemoryInputStream.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+// unknown types are rare in real documents, so they are left out
+std::vector<unsigned char> makeKnownBlockStream(const unsigned rounds)
+{
+  std::vector<unsigned char> out;
+  for (unsigned round = 0; round < rounds; ++round)
+  {
+    for (unsigned type = 0; type < 256; ++type)
+    {
+      if (BLOCK_DESCRIPTORS[type].m_kind != BLOCK_UNKNOWN)
+        appendBlock(out, (unsigned char)(round + type), (unsigned char)type);
+    }
+  }
+  return out;
+}
+
+// decodes the whole stream once and returns the time per block
+template<typename Decode>
+double timeDecoder(MSPUBMemoryStream &input, unsigned long &blocks, Decode decode)
+{
+  unsigned checksum = 0;
+  blocks = 0;
+  input.seek(0, librevenge::RVNG_SEEK_SET);
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while (!input.isEnd())
+  {
+    const MSPUBBlockInfo info = decode(&input);
+    checksum += info.data + info.dataLength;
+    ++blocks;
+  }
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  // keeps the decoding from being optimized away
+  if (checksum == 1)
+    printf(" ");
+  return elapsed.count() / double(blocks);
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+  const unsigned rounds = argc > 1 ? unsigned(atoi(argv[1])) : 4000;
+  const unsigned passes = argc > 2 ? unsigned(atoi(argv[2])) : 50;
+  const std::vector<unsigned char> data = makeKnownBlockStream(rounds);
+
+  MemoryInputStream source(data);
+  MSPUBDocumentContext context(&source);
+  MSPUBCollector collector;
+  TableBlockParser parser(&context, &collector);
+  MSPUBMemoryStream input(&source);
+
+  unsigned long legacyBlocks = 0;
+  unsigned long tableBlocks = 0;
+  double legacy = 0;
+  double table = 0;
+  // the passes alternate, and the fastest of each is kept, to even out
+  // warm-up and noise
+  for (unsigned pass = 0; pass < passes; ++pass)
+  {
+    const double legacyPass = timeDecoder(input, legacyBlocks, [](MSPUBMemoryStream *in)
+    {
+      return legacyParseBlock(in);
+    });
+    const double tablePass = timeDecoder(input, tableBlocks, [&parser](MSPUBMemoryStream *in)
+    {
+      return parser.parseBlock(in);
+    });
+    if (pass == 0 || legacyPass < legacy)
+      legacy = legacyPass;
+    if (pass == 0 || tablePass < table)
+      table = tablePass;
+  }
+
+  printf("%lu bytes, %lu blocks per decoder\n", (unsigned long)data.size(), tableBlocks);
+  printf("switch: %.2f ns per block\n", legacy);
+  printf("table:  %.2f ns per block\n", table);
+  return legacyBlocks == tableBlocks ? 0 : 1;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,104 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks that BLOCK_DESCRIPTORS agrees with the switch it replaced for all
+ * 256 block types, and that the parser decodes a stream holding every type
+ * exactly as the old decoder did.
+ */
+
+#include <stdio.h>
+#include <vector>
+
+#include "BlockDecoders.h"
+#include "MSPUBBlockDescriptor.h"
+#include "MSPUBCollector.h"
+#include "MSPUBDocumentContext.h"
+#include "MemoryInputStream.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+int checkDescriptors()
+{
+  int failures = 0;
+  for (unsigned type = 0; type < 256; ++type)
+  {
+    const BlockDescriptor &descriptor = BLOCK_DESCRIPTORS[type];
+    const short length = legacyBlockDataLength(type);
+    bool matches;
+    if (length < 0)
+      matches = descriptor.m_kind == (legacyIsBlockDataString(type) ? BLOCK_STRING : BLOCK_HIERARCHICAL)
+                && descriptor.m_dataLength == 0 && descriptor.m_inlineLength == 4;
+    else if (descriptor.m_kind == BLOCK_UNKNOWN)
+      matches = length == 0 && descriptor.m_dataLength == 0 && descriptor.m_inlineLength == 0;
+    else
+      matches = descriptor.m_kind == (length <= 4 ? BLOCK_INLINE : BLOCK_OPAQUE)
+                && descriptor.m_dataLength == length && descriptor.m_inlineLength == (length <= 4 ? length : 0);
+    if (!matches)
+    {
+      fprintf(stderr, "descriptor of block type 0x%x differs from the old switch\n", type);
+      ++failures;
+    }
+  }
+  return failures;
+}
+
+bool sameBlock(const MSPUBBlockInfo &a, const MSPUBBlockInfo &b)
+{
+  return a.id == b.id && a.type == b.type && a.startPosition == b.startPosition
+         && a.dataOffset == b.dataOffset && a.dataLength == b.dataLength
+         && a.data == b.data && a.stringData == b.stringData;
+}
+
+int checkDecoding(const std::vector<unsigned char> &data, bool skipHierarchicalData)
+{
+  MemoryInputStream source(data);
+  MSPUBDocumentContext context(&source);
+  MSPUBCollector collector;
+  TableBlockParser parser(&context, &collector);
+  MSPUBMemoryStream legacyInput(&source);
+  MSPUBMemoryStream tableInput(&source);
+
+  int failures = 0;
+  unsigned blocks = 0;
+  while (!legacyInput.isEnd() || !tableInput.isEnd())
+  {
+    const MSPUBBlockInfo legacy = legacyParseBlock(&legacyInput, skipHierarchicalData);
+    const MSPUBBlockInfo table = parser.parseBlock(&tableInput, skipHierarchicalData);
+    ++blocks;
+    if (!sameBlock(legacy, table) || legacyInput.tell() != tableInput.tell())
+    {
+      fprintf(stderr, "block %u of type 0x%x at 0x%lx decodes differently\n", blocks, legacy.type, legacy.startPosition);
+      // the decoders are out of step from here on
+      ++failures;
+      break;
+    }
+  }
+  if (!failures && blocks < 256)
+  {
+    fprintf(stderr, "only %u blocks were decoded\n", blocks);
+    ++failures;
+  }
+  return failures;
+}
+
+} // anonymous namespace
+
+int main()
+{
+  const std::vector<unsigned char> data = makeBlockStream(3);
+  int failures = checkDescriptors();
+  failures += checkDecoding(data, false);
+  failures += checkDecoding(data, true);
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,138 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks that emitting a document copies none of its shapes. The model
+ * has a page background, a plain shape, a group and a text box.
+ */
+
+#include <memory>
+#include <stdio.h>
+#include <vector>
+
+#include "Fill.h"
+#include "Line.h"
+#include "MSPUBCollector.h"
+#include "MSPUBConstants.h"
+#include "MSPUBEmitter.h"
+#include "NoopDrawingInterface.h"
+#include "ShapeInfo.h"
+#include "ShapeType.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+const unsigned PAGE = 1;
+const unsigned BACKGROUND = 2;
+const unsigned TEXT = 3;
+const unsigned RECT = 10;
+const unsigned GROUP = 20;
+const unsigned ARROW = 21;
+const unsigned BOX = 22;
+
+std::vector<unsigned char> toUTF16(const char *text)
+{
+  std::vector<unsigned char> chars;
+  for (const char *c = text; *c; ++c)
+  {
+    chars.push_back((unsigned char)*c);
+    chars.push_back(0);
+  }
+  return chars;
+}
+
+void addShape(MSPUBCollector &collector, unsigned seqNum, ShapeType type, int xs, int ys, int xe, int ye)
+{
+  collector.setShapeOrder(seqNum);
+  collector.setShapePage(seqNum, PAGE);
+  collector.setShapeType(seqNum, type);
+  collector.setShapeCoordinatesInEmu(seqNum, xs, ys, xe, ye);
+}
+
+void buildDocument(MSPUBCollector &collector)
+{
+  collector.setWidthInEmu(8 * EMUS_IN_INCH);
+  collector.setHeightInEmu(10 * EMUS_IN_INCH);
+  collector.addPage(PAGE);
+  collector.setNextPage(PAGE);
+
+  collector.setPageBgShape(PAGE, BACKGROUND);
+  collector.setShapeFill(BACKGROUND, std::make_shared<SolidFill>(ColorReference(0xeeeeee), 1), true);
+
+  addShape(collector, RECT, RECTANGLE, 0, 0, EMUS_IN_INCH, EMUS_IN_INCH);
+  collector.setShapeFill(RECT, std::make_shared<SolidFill>(ColorReference(0x0000ff), 0.5), false);
+  collector.addShapeLine(RECT, Line(ColorReference(0), 12700, true));
+
+  collector.beginGroup();
+  collector.setCurrentGroupSeqNum(GROUP);
+  collector.setShapePage(GROUP, PAGE);
+  collector.setShapeCoordinatesInEmu(GROUP, EMUS_IN_INCH, EMUS_IN_INCH, 5 * EMUS_IN_INCH, 3 * EMUS_IN_INCH);
+
+  addShape(collector, ARROW, LEFT_RIGHT_ARROW, EMUS_IN_INCH, EMUS_IN_INCH, 3 * EMUS_IN_INCH, 2 * EMUS_IN_INCH);
+  std::shared_ptr<GradientFill> gradient = std::make_shared<GradientFill>(45);
+  gradient->addColor(ColorReference(0xff0000), 0, 1);
+  gradient->addColor(ColorReference(0x00ff00), 100, 1);
+  collector.setShapeFill(ARROW, gradient, false);
+  collector.setAdjustValue(ARROW, 0, 5000);
+  collector.setShapeRotation(ARROW, 30);
+  collector.addShapeLine(ARROW, Line(ColorReference(0x000080), 25400, true));
+
+  addShape(collector, BOX, TEXT_BOX, 3 * EMUS_IN_INCH, 2 * EMUS_IN_INCH, 5 * EMUS_IN_INCH, 3 * EMUS_IN_INCH);
+  std::vector<TextSpan> spans;
+  spans.push_back(TextSpan(toUTF16("Hello  world"), CharacterStyle()));
+  spans.push_back(TextSpan(toUTF16("\tagain"), CharacterStyle()));
+  std::vector<TextParagraph> paragraphs;
+  paragraphs.push_back(TextParagraph(spans, ParagraphStyle()));
+  collector.addTextString(paragraphs, TEXT);
+  collector.addTextShape(TEXT, BOX);
+  collector.setShapeFill(BOX, std::make_shared<SolidFill>(ColorReference(0xffffff), 1), false);
+
+  collector.endGroup();
+}
+
+} // anonymous namespace
+
+int main()
+{
+  MSPUBCollector collector;
+  buildDocument(collector);
+  if (!collector.go())
+  {
+    fprintf(stderr, "the model could not be completed\n");
+    return 1;
+  }
+
+  int failures = 0;
+  // the model is emitted twice, as MSPUBDocument::parse(painter) does
+  for (int i = 0; i < 2; ++i)
+  {
+    NoopDrawingInterface painter;
+    ShapeInfo::copyCount() = 0;
+    if (!MSPUBEmitter(collector.getModel()).emit(&painter))
+    {
+      fprintf(stderr, "emitting failed\n");
+      return 1;
+    }
+    const unsigned long copies = ShapeInfo::copyCount();
+    if (copies != 0)
+    {
+      fprintf(stderr, "emitting copied %lu shapes\n", copies);
+      ++failures;
+    }
+    if (painter.m_pages != 1 || painter.m_objects < 4 || painter.m_texts == 0)
+    {
+      fprintf(stderr, "unexpected output: %u pages, %u objects, %u texts\n", painter.m_pages, painter.m_objects, painter.m_texts);
+      ++failures;
+    }
+  }
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,370 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks that a model stored in the parse cache and loaded again emits
+ * exactly what the model the parsers built does, and stores back into the
+ * same entry. Then checks that entries with a wrong magic, format version,
+ * digest, payload length or payload hash, damaged or truncated, are not
+ * loaded.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "Arrow.h"
+#include "Dash.h"
+#include "Fill.h"
+#include "ImgInfo.h"
+#include "Line.h"
+#include "MSPUBCollector.h"
+#include "MSPUBConstants.h"
+#include "MSPUBDocumentContext.h"
+#include "MSPUBEmitter.h"
+#include "MSPUBParseCache.h"
+#include "MemoryInputStream.h"
+#include "RecordingDrawingInterface.h"
+#include "SHA256.h"
+#include "Shadow.h"
+#include "ShapeType.h"
+#include "TableInfo.h"
+#include "VerticalAlign.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+const char CACHE_DIR[] = ".";
+
+const unsigned MASTER = 1;
+const unsigned PAGE = 2;
+const unsigned BACKGROUND = 3;
+const unsigned TEXT = 4;
+const unsigned CELL_TEXT = 5;
+const unsigned FOOTER = 10;
+const unsigned RECT = 11;
+const unsigned PICTURE = 12;
+const unsigned PATTERN = 13;
+const unsigned ARROW_LINE = 14;
+const unsigned TABLE = 15;
+const unsigned GROUP = 20;
+const unsigned ARROW = 21;
+const unsigned BOX = 22;
+
+// where the header fields of an entry are
+const unsigned long MAGIC_OFFSET = 0;
+const unsigned long VERSION_OFFSET = 4;
+const unsigned long DIGEST_OFFSET = 8;
+const unsigned long PAYLOAD_LENGTH_OFFSET = 40;
+const unsigned long PAYLOAD_HASH_OFFSET = 48;
+const unsigned long PAYLOAD_OFFSET = 56;
+
+std::vector<unsigned char> toUTF16(const char *text)
+{
+  std::vector<unsigned char> chars;
+  for (const char *c = text; *c; ++c)
+  {
+    chars.push_back((unsigned char)*c);
+    chars.push_back(0);
+  }
+  return chars;
+}
+
+std::vector<TextParagraph> makeText(const char *first, const char *second)
+{
+  CharacterStyle bold;
+  bold.bold = true;
+  bold.textSizeInPt = 14;
+  bold.colorIndex = 0;
+  bold.fontIndex = 0;
+  ParagraphStyle centered;
+  centered.m_align = CENTER;
+  centered.m_spaceAfterEmu = 12700;
+  centered.m_tabStopsInEmu.push_back(EMUS_IN_INCH);
+
+  std::vector<TextParagraph> paragraphs;
+  std::vector<TextSpan> spans;
+  spans.push_back(TextSpan(toUTF16(first), bold));
+  paragraphs.push_back(TextParagraph(spans, centered));
+  spans.clear();
+  spans.push_back(TextSpan(toUTF16(second), CharacterStyle()));
+  spans.push_back(TextSpan(toUTF16("\tend\r"), bold));
+  paragraphs.push_back(TextParagraph(spans, ParagraphStyle()));
+  return paragraphs;
+}
+
+void addShape(MSPUBCollector &collector, unsigned seqNum, unsigned page, ShapeType type, int xs, int ys, int xe, int ye)
+{
+  collector.setShapeOrder(seqNum);
+  collector.setShapePage(seqNum, page);
+  collector.setShapeType(seqNum, type);
+  collector.setShapeCoordinatesInEmu(seqNum, xs, ys, xe, ye);
+}
+
+// does what the parsers would, with a bit of everything that is cached
+void buildDocument(MSPUBCollector &collector)
+{
+  librevenge::RVNGPropertyList metaData;
+  metaData.insert("dc:title", "Cached");
+  collector.collectMetaData(metaData);
+  collector.setWidthInEmu(8 * EMUS_IN_INCH);
+  collector.setHeightInEmu(10 * EMUS_IN_INCH);
+  collector.addFont(toUTF16("Liberation Serif"));
+  collector.addTextColor(ColorReference(0x00336699));
+  collector.addPaletteColor(Color(0x11, 0x22, 0x33));
+  collector.addDefaultCharacterStyle(CharacterStyle());
+  collector.addDefaultParagraphStyle(ParagraphStyle());
+  const unsigned char fontData[] = { 'E', 'O', 'T', 0 };
+  collector.addEOTFont("Embedded", librevenge::RVNGBinaryData(fontData, sizeof(fontData)));
+  const unsigned char imageData[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n', 1, 2, 3 };
+  collector.addImage(1, ImgInfo(PNG, librevenge::RVNGBinaryData(imageData, sizeof(imageData))));
+
+  collector.addPage(MASTER);
+  collector.designateMasterPage(MASTER);
+  collector.addPage(PAGE);
+  collector.setNextPage(PAGE);
+  collector.setMasterPage(PAGE, MASTER);
+
+  addShape(collector, FOOTER, MASTER, RECTANGLE, 0, 9 * EMUS_IN_INCH, 8 * EMUS_IN_INCH, 10 * EMUS_IN_INCH);
+  collector.setShapeFill(FOOTER, std::make_shared<SolidFill>(ColorReference(0x00cccccc), 1), false);
+
+  collector.setPageBgShape(PAGE, BACKGROUND);
+  collector.setShapeFill(BACKGROUND, std::make_shared<SolidFill>(ColorReference(0xeeeeee), 1), true);
+
+  addShape(collector, RECT, PAGE, RECTANGLE, 0, 0, EMUS_IN_INCH, EMUS_IN_INCH);
+  collector.setShapeFill(RECT, std::make_shared<SolidFill>(ColorReference(0x0000ff), 0.5), false);
+  collector.addShapeLine(RECT, Line(ColorReference(0), 12700, true));
+  Dash dash(0.5, ROUND_DOT);
+  dash.m_dots.push_back(Dot(2, 0.25));
+  collector.setShapeDash(RECT, dash);
+  collector.setShapeShadow(RECT, Shadow(OFFSET, 25400, 25400, 0, 0, 0, 0, 0.5, ColorReference(0x808080), ColorReference(0)));
+
+  addShape(collector, PICTURE, PAGE, PICTURE_FRAME, 0, 4 * EMUS_IN_INCH, 2 * EMUS_IN_INCH, 6 * EMUS_IN_INCH);
+  collector.setShapeImgIndex(PICTURE, 1);
+  collector.setShapePictureBrightness(PICTURE, 10);
+  collector.setShapeCropType(PICTURE, ELLIPSE);
+
+  addShape(collector, PATTERN, PAGE, ELLIPSE, 2 * EMUS_IN_INCH, 4 * EMUS_IN_INCH, 4 * EMUS_IN_INCH, 6 * EMUS_IN_INCH);
+  collector.setShapeFill(PATTERN, std::make_shared<PatternFill>(1, ColorReference(0xff0000), ColorReference(0xffffff)), false);
+  collector.setShapeFlip(PATTERN, true, false);
+
+  addShape(collector, ARROW_LINE, PAGE, LINE, 0, 7 * EMUS_IN_INCH, 4 * EMUS_IN_INCH, 8 * EMUS_IN_INCH);
+  collector.addShapeLine(ARROW_LINE, Line(ColorReference(0x008000), 19050, true));
+  collector.setShapeBeginArrow(ARROW_LINE, Arrow(TRIANGLE_ARROW, MEDIUM, LARGE));
+  collector.setShapeEndArrow(ARROW_LINE, Arrow(CIRCLE_ARROW, SMALL, SMALL));
+
+  addShape(collector, TABLE, PAGE, RECTANGLE, 4 * EMUS_IN_INCH, 4 * EMUS_IN_INCH, 8 * EMUS_IN_INCH, 6 * EMUS_IN_INCH);
+  TableInfo table(1, 2);
+  table.m_rowHeightsInEmu.push_back(2 * EMUS_IN_INCH);
+  table.m_columnWidthsInEmu.push_back(2 * EMUS_IN_INCH);
+  table.m_columnWidthsInEmu.push_back(2 * EMUS_IN_INCH);
+  for (unsigned column = 0; column < 2; ++column)
+  {
+    CellInfo cell;
+    cell.m_startColumn = column;
+    cell.m_endColumn = column;
+    table.m_cells.push_back(cell);
+  }
+  collector.setShapeTableInfo(TABLE, table);
+  collector.addTextString(makeText("left", "right"), CELL_TEXT);
+  collector.addTextShape(CELL_TEXT, TABLE);
+  std::vector<unsigned> cellEnds;
+  cellEnds.push_back(5);
+  cellEnds.push_back(16);
+  collector.setTableCellTextEnds(CELL_TEXT, cellEnds);
+
+  collector.beginGroup();
+  collector.setCurrentGroupSeqNum(GROUP);
+  collector.setShapePage(GROUP, PAGE);
+  collector.setShapeCoordinatesInEmu(GROUP, EMUS_IN_INCH, EMUS_IN_INCH, 5 * EMUS_IN_INCH, 3 * EMUS_IN_INCH);
+
+  addShape(collector, ARROW, PAGE, LEFT_RIGHT_ARROW, EMUS_IN_INCH, EMUS_IN_INCH, 3 * EMUS_IN_INCH, 2 * EMUS_IN_INCH);
+  std::shared_ptr<GradientFill> gradient = std::make_shared<GradientFill>(45);
+  gradient->addColor(ColorReference(0xff0000), 0, 1);
+  gradient->addColor(ColorReference(0x00ff00), 100, 0.5);
+  gradient->setFillCenter(0.25, 0.25, 0.75, 0.75);
+  collector.setShapeFill(ARROW, gradient, false);
+  collector.setAdjustValue(ARROW, 0, 5000);
+  collector.setShapeRotation(ARROW, 30);
+  collector.addShapeLine(ARROW, Line(ColorReference(0x000080), 25400, true));
+
+  addShape(collector, BOX, PAGE, TEXT_BOX, 3 * EMUS_IN_INCH, 2 * EMUS_IN_INCH, 5 * EMUS_IN_INCH, 3 * EMUS_IN_INCH);
+  collector.addTextString(makeText("Hello  world", "again"), TEXT);
+  collector.addTextShape(TEXT, BOX);
+  collector.setShapeMargins(BOX, 45720, 45720, 45720, 45720);
+  collector.setShapeVerticalTextAlign(BOX, MIDDLE);
+  collector.setShapeNumColumns(BOX, 2);
+  collector.setShapeColumnSpacing(BOX, 91440);
+
+  collector.endGroup();
+}
+
+std::string emit(MSPUBCollector &collector)
+{
+  RecordingDrawingInterface painter;
+  if (!collector.go() || !MSPUBEmitter(collector.getModel()).emit(&painter))
+    return std::string();
+  return painter.m_output;
+}
+
+std::vector<unsigned char> readFile(const std::string &path)
+{
+  std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+  return std::vector<unsigned char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+bool writeFile(const std::string &path, const std::vector<unsigned char> &contents)
+{
+  std::ofstream file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(contents.data()), contents.size());
+  file.close();
+  return bool(file);
+}
+
+bool loadEntry(MSPUBDocumentContext &context)
+{
+  MSPUBCollector collector;
+  return MSPUBParseCache(context).load(collector);
+}
+
+// checks that the entry is rejected once damaged, and loaded once restored
+int checkRejected(MSPUBDocumentContext &context, const std::string &path, const std::vector<unsigned char> &entry,
+                  const std::vector<unsigned char> &damaged, const char *what)
+{
+  int failures = 0;
+  if (!writeFile(path, damaged) || loadEntry(context))
+  {
+    fprintf(stderr, "an entry with %s was loaded\n", what);
+    ++failures;
+  }
+  if (!writeFile(path, entry) || !loadEntry(context))
+  {
+    fprintf(stderr, "the entry restored after %s was not loaded\n", what);
+    ++failures;
+  }
+  return failures;
+}
+
+int checkDamage(MSPUBDocumentContext &context, const std::string &path, const std::vector<unsigned char> &entry)
+{
+  struct Damage
+  {
+    unsigned long offset;
+    const char *what;
+  };
+  const Damage damages[] =
+  {
+    { MAGIC_OFFSET, "a wrong magic" },
+    { VERSION_OFFSET, "a wrong format version" },
+    { DIGEST_OFFSET + 31, "a wrong digest" },
+    { PAYLOAD_LENGTH_OFFSET, "a wrong payload length" },
+    { PAYLOAD_LENGTH_OFFSET + 7, "a huge payload length" },
+    { PAYLOAD_HASH_OFFSET + 3, "a wrong payload hash" },
+    { PAYLOAD_OFFSET + 10, "a damaged payload" },
+  };
+
+  int failures = 0;
+  for (const Damage &damage : damages)
+  {
+    std::vector<unsigned char> damaged(entry);
+    damaged[damage.offset] ^= 0x01;
+    failures += checkRejected(context, path, entry, damaged, damage.what);
+  }
+
+  const unsigned long lengths[] = { 0, VERSION_OFFSET + 2, PAYLOAD_HASH_OFFSET, PAYLOAD_OFFSET, (unsigned long)entry.size() - 1 };
+  for (const unsigned long length : lengths)
+  {
+    const std::vector<unsigned char> truncated(entry.begin(), entry.begin() + long(length));
+    char what[64];
+    snprintf(what, sizeof(what), "only %lu bytes", length);
+    failures += checkRejected(context, path, entry, truncated, what);
+  }
+
+  std::vector<unsigned char> extended(entry);
+  extended.push_back(0);
+  failures += checkRejected(context, path, entry, extended, "a byte after the payload");
+  return failures;
+}
+
+void setCacheDir(const char *dir)
+{
+#ifdef _WIN32
+  _putenv_s("LIBMSPUB_CACHE_DIR", dir);
+#else
+  setenv("LIBMSPUB_CACHE_DIR", dir, 1);
+#endif
+}
+
+} // anonymous namespace
+
+int main()
+{
+  setCacheDir(CACHE_DIR);
+  // the content only keys the entry; the model does not come from it
+  const std::vector<unsigned char> document = toUTF16("parsecachetest document");
+  SHA256 sha;
+  sha.update(document.data(), document.size());
+  const std::string path = std::string(CACHE_DIR) + '/' + SHA256::toHex(sha.finish()) + ".pubcache";
+  remove(path.c_str());
+
+  MemoryInputStream input(document);
+  MSPUBDocumentContext context(&input);
+
+  int failures = 0;
+  MSPUBCollector parsed;
+  buildDocument(parsed);
+  MSPUBParseCache(context).store(parsed);
+  const std::string expected = emit(parsed);
+  const std::vector<unsigned char> entry = readFile(path);
+  if (expected.empty() || entry.size() <= PAYLOAD_OFFSET)
+  {
+    fprintf(stderr, "the document could not be emitted or stored\n");
+    remove(path.c_str());
+    return 1;
+  }
+
+  MSPUBCollector loaded;
+  if (!MSPUBParseCache(context).load(loaded))
+  {
+    fprintf(stderr, "the stored entry was not loaded\n");
+    remove(path.c_str());
+    return 1;
+  }
+  remove(path.c_str());
+  MSPUBParseCache(context).store(loaded);
+  if (readFile(path) != entry)
+  {
+    fprintf(stderr, "the loaded model stores another entry\n");
+    ++failures;
+  }
+  const std::string output = emit(loaded);
+  if (output != expected)
+  {
+    // show the first call that differs
+    std::string::size_type pos = 0;
+    while (pos < output.size() && pos < expected.size() && output[pos] == expected[pos])
+      ++pos;
+    pos = expected.rfind('\n', pos);
+    pos = pos == std::string::npos ? 0 : pos + 1;
+    fprintf(stderr, "the loaded model emits\n%s\ninstead of\n%s\n",
+            output.substr(pos, output.find('\n', pos) - pos).c_str(), expected.substr(pos, expected.find('\n', pos) - pos).c_str());
+    ++failures;
+  }
+
+  failures += checkDamage(context, path, entry);
+  remove(path.c_str());
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
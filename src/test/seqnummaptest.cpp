@@ -0,0 +1,207 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks SeqNumMap against std::map: keys in sequence, a far key that
+ * has to go to the sparse map, sparse keys that the vector grows over,
+ * iteration over both parts, and erase, find and count.
+ */
+
+#include <map>
+#include <stdio.h>
+#include <utility>
+
+#include "SeqNumMap.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+const unsigned FAR_KEY = 4000000000u;
+
+int failures = 0;
+
+void check(const bool ok, const char *what)
+{
+  if (!ok)
+  {
+    fprintf(stderr, "%s\n", what);
+    ++failures;
+  }
+}
+
+// compares everything that can be read from map with expected
+void checkSame(const SeqNumMap<int> &map, const std::map<unsigned, int> &expected, const char *what)
+{
+  bool same = map.size() == expected.size() && map.empty() == expected.empty();
+  SeqNumMap<int>::const_iterator it = map.begin();
+  for (const auto &value : expected)
+  {
+    if (it == map.end() || it->first != value.first || it->second != value.second)
+    {
+      same = false;
+      break;
+    }
+    ++it;
+    const SeqNumMap<int>::const_iterator found = map.find(value.first);
+    if (found == map.end() || found->first != value.first || found->second != value.second || map.count(value.first) != 1)
+      same = false;
+  }
+  if (it != map.end())
+    same = false;
+  if (!same)
+  {
+    fprintf(stderr, "%s: the map differs from the expected one\n", what);
+    ++failures;
+  }
+}
+
+void checkDense()
+{
+  SeqNumMap<int> map;
+  std::map<unsigned, int> expected;
+  for (unsigned key = 0; key < 1000; ++key)
+  {
+    const int value = int(key * 7);
+    map[key] = value;
+    expected[key] = value;
+  }
+  checkSame(map, expected, "keys in sequence");
+  check(map.find(1000) == map.end() && map.count(1000) == 0, "a key that was never inserted is found");
+
+  const std::pair<SeqNumMap<int>::iterator, bool> again = map.insert(std::make_pair(10u, -1));
+  check(!again.second && again.first->second == 70, "inserting an existing key replaced its value");
+  map[10] = -1;
+  expected[10] = -1;
+  checkSame(map, expected, "a value assigned through operator[]");
+}
+
+void checkSparse()
+{
+  SeqNumMap<int> map;
+  std::map<unsigned, int> expected;
+  for (unsigned key = 0; key < 10; ++key)
+  {
+    map[key] = int(key);
+    expected[key] = int(key);
+  }
+  map[FAR_KEY] = 1;
+  expected[FAR_KEY] = 1;
+  checkSame(map, expected, "a far key");
+
+  // a value in the vector would move as it grows; one in the sparse map
+  // stays put
+  const int *const farValue = &map[FAR_KEY];
+  for (unsigned key = 10; key < 2000; ++key)
+  {
+    map[key] = int(key);
+    expected[key] = int(key);
+  }
+  check(&map[FAR_KEY] == farValue, "a far key was put into the vector");
+  checkSame(map, expected, "keys in sequence after a far key");
+}
+
+void checkMigration()
+{
+  SeqNumMap<int> map;
+  std::map<unsigned, int> expected;
+  // sparse, as the map is empty
+  const unsigned sparseKeys[] = { 5000, 3000, 70000 };
+  for (const unsigned key : sparseKeys)
+  {
+    map[key] = -int(key);
+    expected[key] = -int(key);
+  }
+  checkSame(map, expected, "sparse keys only");
+
+  // the vector grows over 3000 and 5000, but not over 70000
+  for (unsigned key = 0; key < 6000; ++key)
+  {
+    if (key == 3000 || key == 5000)
+    {
+      check(!map.insert(std::make_pair(key, 0)).second, "a sparse key was lost as the vector grew over it");
+      continue;
+    }
+    map[key] = int(key);
+    expected[key] = int(key);
+  }
+  checkSame(map, expected, "sparse keys that the vector grew over");
+}
+
+void checkIteration()
+{
+  SeqNumMap<int> map;
+  std::map<unsigned, int> expected;
+  // out of order, with gaps, in both parts
+  const unsigned keys[] = { FAR_KEY, 7, 1000000, 0, 3, FAR_KEY - 1, 255, 2, 500000 };
+  for (const unsigned key : keys)
+  {
+    map.insert(std::make_pair(key, int(key % 1000)));
+    expected.insert(std::make_pair(key, int(key % 1000)));
+  }
+  checkSame(map, expected, "keys out of order");
+
+  unsigned n = 0;
+  unsigned last = 0;
+  for (SeqNumMap<int>::iterator it = map.begin(); it != map.end(); ++it, ++n)
+  {
+    check(n == 0 || it->first > last, "iteration is not in key order");
+    last = it->first;
+    it->second += 1;
+  }
+  check(n == expected.size(), "iteration missed keys");
+  for (auto &value : expected)
+    value.second += 1;
+  checkSame(map, expected, "values changed through iterators");
+}
+
+void checkErase()
+{
+  SeqNumMap<int> map;
+  std::map<unsigned, int> expected;
+  for (unsigned key = 0; key < 20; ++key)
+  {
+    map[key] = int(key);
+    expected[key] = int(key);
+  }
+  map[FAR_KEY] = 1;
+  expected[FAR_KEY] = 1;
+
+  const unsigned erased[] = { 0, 5, 19, FAR_KEY };
+  for (const unsigned key : erased)
+  {
+    check(map.erase(key) == 1, "erasing a key did not erase it");
+    expected.erase(key);
+    check(map.find(key) == map.end() && map.count(key) == 0, "an erased key is found");
+  }
+  check(map.erase(5) == 0 && map.erase(20) == 0 && map.erase(FAR_KEY - 1) == 0, "erasing an absent key erased something");
+  checkSame(map, expected, "erased keys");
+
+  check(map.insert(std::make_pair(5u, 55)).second, "an erased key could not be inserted again");
+  expected[5] = 55;
+  checkSame(map, expected, "an erased key inserted again");
+
+  map.clear();
+  expected.clear();
+  checkSame(map, expected, "a cleared map");
+}
+
+} // anonymous namespace
+
+int main()
+{
+  checkDense();
+  checkSparse();
+  checkMigration();
+  checkIteration();
+  checkErase();
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
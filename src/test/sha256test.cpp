@@ -0,0 +1,77 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks SHA256 against the FIPS 180-4 examples, and that the digest does
+ * not depend on how the input is split between calls to update().
+ */
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "SHA256.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+std::string hash(const std::vector<unsigned char> &data, const unsigned long piece)
+{
+  SHA256 sha;
+  for (unsigned long i = 0; i < data.size(); i += piece)
+    sha.update(data.data() + i, std::min<unsigned long>(piece, data.size() - i));
+  return SHA256::toHex(sha.finish());
+}
+
+int check(const char *name, const std::vector<unsigned char> &data, const char *expected)
+{
+  int failures = 0;
+  const unsigned long pieces[] = { 1, 3, 63, 64, 65, 1000, data.size() + 1 };
+  for (const unsigned long piece : pieces)
+  {
+    const std::string digest = hash(data, piece);
+    if (digest != expected)
+    {
+      fprintf(stderr, "%s, hashed %lu bytes at a time: %s, expected %s\n", name, piece, digest.c_str(), expected);
+      ++failures;
+    }
+  }
+  return failures;
+}
+
+std::vector<unsigned char> bytes(const char *text)
+{
+  return std::vector<unsigned char>(text, text + strlen(text));
+}
+
+} // anonymous namespace
+
+int main()
+{
+  int failures = 0;
+  failures += check("empty", bytes(""),
+                    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  failures += check("abc", bytes("abc"),
+                    "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  failures += check("two blocks", bytes("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+                    "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  failures += check("a million a", std::vector<unsigned char>(1000000, 'a'),
+                    "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+  // the length field just fits into, or just overflows, the last block
+  failures += check("55 bytes", std::vector<unsigned char>(55, 'x'),
+                    "d5e285683cd4efc02d021a5c62014694958901005d6f71e89e0989fac77e4072");
+  failures += check("56 bytes", std::vector<unsigned char>(56, 'x'),
+                    "04c26261370ee7541549d16dee320c723e3fd14671e66a099afe0a377c16888e");
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
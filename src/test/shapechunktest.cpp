@@ -0,0 +1,334 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/*
+ * This file is part of the libmspub project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/* Checks that the shape chunks are parsed alike on one thread and on
+ * several: whole, with a chunk that fails and with one that throws partway
+ * through. Also checks that parallelFor rethrows the exception of the
+ * first failing item once the items before it are done, and how a
+ * ConcurrentTask is waited for and dropped.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MSPUBBlockID.h"
+#include "MSPUBCollector.h"
+#include "MSPUBContentChunkType.h"
+#include "MSPUBDocumentContext.h"
+#include "MSPUBMemoryStream.h"
+#include "MSPUBParser.h"
+#include "MemoryInputStream.h"
+#include "WorkerPool.h"
+#include "libmspub_utils.h"
+
+using namespace libmspub;
+
+namespace
+{
+
+// enough for several threads at SHAPE_CHUNKS_PER_THREAD
+const unsigned CHUNK_COUNT = 3000;
+const unsigned THREAD_COUNTS[] = { 2, 4, 8 };
+
+int failures = 0;
+
+void check(const bool ok, const char *what)
+{
+  if (!ok)
+  {
+    fprintf(stderr, "%s\n", what);
+    ++failures;
+  }
+}
+
+// exposes the shape chunk parsing
+class ShapeChunkParser : public MSPUBParser
+{
+public:
+  ShapeChunkParser(MSPUBDocumentContext *context, MSPUBCollector *collector)
+    : MSPUBParser(context, collector)
+  {
+  }
+
+  void addShapeChunk(const unsigned type, const unsigned long offset, const unsigned seqNum)
+  {
+    m_shapeChunkIndices.push_back(addContentChunk(ContentChunkReference(type, offset, 0, seqNum, 0)));
+  }
+
+  using MSPUBParser::parseShapeChunks;
+};
+
+void appendU32(std::vector<unsigned char> &out, const unsigned value)
+{
+  for (unsigned i = 0; i < 4; ++i)
+    out.push_back((unsigned char)(value >> (8 * i)));
+}
+
+void appendBlock(std::vector<unsigned char> &out, const unsigned char id, const unsigned value)
+{
+  out.push_back(id);
+  out.push_back(0x20);
+  appendU32(out, value);
+}
+
+// a shape chunk whose blocks all depend on n
+void appendShapeChunk(std::vector<unsigned char> &out, const unsigned n)
+{
+  std::vector<unsigned char> blocks;
+  appendBlock(blocks, SHAPE_WIDTH, 100 + n);
+  appendBlock(blocks, SHAPE_HEIGHT, 200 + n);
+  appendBlock(blocks, SHAPE_VALIGN, n % 3);
+  if (n % 2)
+    appendBlock(blocks, SHAPE_DONT_STRETCH_BA, 0);
+  if (n % 3 == 0)
+    appendBlock(blocks, SHAPE_TEXT_ID, n);
+  if (n % 5)
+    appendBlock(blocks, SHAPE_CROP, n % 5);
+  if (n % 7 == 0)
+    appendBlock(blocks, SHAPE_BORDER_IMAGE_ID, n / 7);
+  appendU32(out, unsigned(4 + blocks.size()));
+  out.insert(out.end(), blocks.begin(), blocks.end());
+}
+
+/* The content for CHUNK_COUNT shape chunks. The chunk at failing, if any,
+ * is a table without the blocks it needs; the one at throwing, if any, is
+ * cut short by the end of the stream.
+ */
+struct Contents
+{
+  Contents(const unsigned failing, const unsigned throwing)
+    : m_data(), m_offsets(), m_types()
+  {
+    for (unsigned n = 0; n < CHUNK_COUNT; ++n)
+    {
+      m_offsets.push_back(m_data.size());
+      m_types.push_back(n == failing ? TABLE : SHAPE);
+      if (n == failing)
+        appendU32(m_data, 4);
+      else if (n != throwing)
+        appendShapeChunk(m_data, n);
+    }
+    if (throwing < CHUNK_COUNT)
+    {
+      m_offsets[throwing] = m_data.size();
+      appendU32(m_data, 100);
+      appendBlock(m_data, SHAPE_WIDTH, 1);
+      m_data.push_back(SHAPE_HEIGHT);
+      m_data.push_back(0x20);
+      m_data.push_back(0);
+    }
+  }
+
+  std::vector<unsigned char> m_data;
+  std::vector<unsigned long> m_offsets;
+  std::vector<unsigned> m_types;
+};
+
+void appendValue(std::string &out, const char *name, const unsigned value)
+{
+  out += ' ';
+  out += name;
+  out += '=';
+  out += std::to_string(value);
+}
+
+// what the shape chunks leave in the model
+std::string describe(const MSPUBCollector &collector)
+{
+  std::string out;
+  for (const auto &entry : collector.getModel().m_shapeInfosBySeqNum)
+  {
+    const ShapeInfo &info = entry.second;
+    const ShapeExtraInfo &extra = info.getExtra();
+    out += std::to_string(entry.first);
+    if (info.m_textId)
+      appendValue(out, "text", get(info.m_textId));
+    if (extra.m_verticalAlign)
+      appendValue(out, "valign", unsigned(get(extra.m_verticalAlign)));
+    if (extra.m_cropType)
+      appendValue(out, "crop", unsigned(get(extra.m_cropType)));
+    if (extra.m_borderImgIndex)
+      appendValue(out, "border", get(extra.m_borderImgIndex));
+    if (extra.m_stretchBorderArt)
+      out += " stretch";
+    if (extra.m_tableInfo)
+      out += " table";
+    out += '\n';
+  }
+  return out;
+}
+
+// Parses the shape chunks of contents on threadCount threads and returns
+// the result and the model.
+std::string parse(const Contents &contents, const unsigned threadCount)
+{
+  setThreadCount(threadCount);
+  MemoryInputStream source(contents.m_data);
+  MSPUBDocumentContext context(&source);
+  MSPUBCollector collector;
+  ShapeChunkParser parser(&context, &collector);
+  for (unsigned n = 0; n < CHUNK_COUNT; ++n)
+    parser.addShapeChunk(contents.m_types[n], contents.m_offsets[n], n);
+  MSPUBMemoryStream input(&source);
+
+  std::string result;
+  try
+  {
+    result = parser.parseShapeChunks(&input) ? "parsed\n" : "failed\n";
+  }
+  catch (const EndOfStreamException &)
+  {
+    result = "end of stream\n";
+  }
+  return result + describe(collector);
+}
+
+// Parses contents on one thread and on several, expecting the result
+// expected and the properties of the first applied chunks.
+void checkShapeChunks(const unsigned failing, const unsigned throwing, const std::string &expected, const unsigned applied, const char *what)
+{
+  const Contents contents(failing, throwing);
+  const std::string sequential = parse(contents, 1);
+  const unsigned shapes = unsigned(std::count(sequential.begin(), sequential.end(), '\n')) - 1;
+  if (sequential.compare(0, expected.size(), expected) != 0 || shapes != applied)
+  {
+    fprintf(stderr, "%s: %u shapes parsed on one thread, with the result %s", what, shapes, sequential.substr(0, sequential.find('\n') + 1).c_str());
+    ++failures;
+  }
+  for (const unsigned threadCount : THREAD_COUNTS)
+  {
+    if (parse(contents, threadCount) != sequential)
+    {
+      fprintf(stderr, "%s: parsed differently on %u threads\n", what, threadCount);
+      ++failures;
+    }
+  }
+}
+
+void checkParallelFor()
+{
+  const unsigned long count = 100000;
+  for (const unsigned threadCount : THREAD_COUNTS)
+  {
+    setThreadCount(threadCount);
+    std::vector<std::atomic<unsigned> > calls(count);
+    for (std::atomic<unsigned> &c : calls)
+      c = 0;
+    parallelFor(count, 1, [&calls](unsigned long i)
+    {
+      ++calls[i];
+    });
+    bool once = true;
+    for (const std::atomic<unsigned> &c : calls)
+      once = once && c == 1;
+    check(once, "parallelFor did not do every item once");
+
+    for (std::atomic<unsigned> &c : calls)
+      c = 0;
+    // the later item throws first
+    std::atomic<bool> lateThrown(false);
+    unsigned long thrown = 0;
+    try
+    {
+      parallelFor(count, 1, [&calls, &lateThrown](unsigned long i)
+      {
+        ++calls[i];
+        if (i == 70000)
+        {
+          lateThrown = true;
+          throw std::runtime_error(std::to_string(i));
+        }
+        if (i == 30000)
+        {
+          const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+          while (!lateThrown && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+          throw std::runtime_error(std::to_string(i));
+        }
+      });
+    }
+    catch (const std::runtime_error &e)
+    {
+      thrown = std::stoul(e.what());
+    }
+    check(thrown == 30000, "parallelFor did not rethrow the exception of the first failing item");
+    bool done = true;
+    for (unsigned long i = 0; i <= 30000; ++i)
+      done = done && calls[i] == 1;
+    check(done, "parallelFor did not finish the items before the failing one");
+  }
+}
+
+void checkConcurrentTask()
+{
+  for (const unsigned threadCount : { 1u, 4u })
+  {
+    setThreadCount(threadCount);
+    bool ran = false;
+    {
+      ConcurrentTask task([&ran]()
+      {
+        ran = true;
+      });
+      task.wait();
+    }
+    check(ran, "a task was not run by wait()");
+
+    bool thrown = false;
+    {
+      ConcurrentTask task([]()
+      {
+        throw std::runtime_error("task");
+      });
+      try
+      {
+        task.wait();
+      }
+      catch (const std::runtime_error &)
+      {
+        thrown = true;
+      }
+    }
+    check(thrown, "wait() did not rethrow the exception of a task");
+  }
+
+  // with no threads, nothing starts a task but wait()
+  setThreadCount(1);
+  bool ran = false;
+  {
+    ConcurrentTask task([&ran]()
+    {
+      ran = true;
+    });
+  }
+  check(!ran, "a task that was not waited for was run on one thread");
+}
+
+} // anonymous namespace
+
+int main()
+{
+  checkShapeChunks(CHUNK_COUNT, CHUNK_COUNT, "parsed\n", CHUNK_COUNT, "all chunks valid");
+  checkShapeChunks(1700, CHUNK_COUNT, "failed\n", 1700, "a failing chunk");
+  checkShapeChunks(CHUNK_COUNT, 1700, "end of stream\n", 1700, "a throwing chunk");
+  checkShapeChunks(2500, 1700, "end of stream\n", 1700, "a throwing chunk before a failing one");
+  checkShapeChunks(600, 1700, "failed\n", 600, "a failing chunk before a throwing one");
+  checkShapeChunks(0, CHUNK_COUNT, "failed\n", 0, "a failing first chunk");
+  checkParallelFor();
+  checkConcurrentTask();
+  return failures ? 1 : 0;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */